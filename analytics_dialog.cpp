@@ -0,0 +1,140 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "analytics_dialog.h"
+
+#include <QDialogButtonBox>
+#include <QDir>
+#include <QFile>
+#include <QFileDialog>
+#include <QHeaderView>
+#include <QInputDialog>
+#include <QLabel>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QVBoxLayout>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    AnalyticsDialog::AnalyticsDialog(const ParameterTable *table,
+                                     QWidget *parent)
+                   : QDialog(parent, 0),
+                     table(table)
+    {
+      setWindowTitle(tr("Analyze files"));
+
+      const QVector<int> varying = table->varying_columns();
+
+      QString summary = tr("%1 of %2 parameters differ between %n file(s).", "",
+                           table->file_names().size())
+                        .arg(varying.size())
+                        .arg(table->column_count());
+      if (!table->errors().isEmpty())
+        summary += "\n" + tr("%n file(s) could not be read.", "", table->errors().size());
+
+      QLabel *summary_label = new QLabel(summary, this);
+
+      parameter_list = new QTreeWidget(this);
+      parameter_list->setColumnCount(3);
+      parameter_list->setHeaderLabels(QStringList() << tr("Parameter")
+                                                    << tr("Values")
+                                                    << tr("Distribution"));
+      parameter_list->setRootIsDecorated(false);
+      parameter_list->setUniformRowHeights(true);
+
+      // nobody reads through more values than this
+      const int max_values = 10;
+
+      QList<QTreeWidgetItem *> items;
+      for (int i = 0; i < varying.size(); ++i)
+        {
+          const QVector<QPair<QString, int> > distribution = table->distribution(varying[i]);
+
+          QStringList values;
+          for (int v = 0; v < distribution.size() && v < max_values; ++v)
+            values.append(tr("%1 (%2)")
+                          .arg(distribution[v].first.isNull() ? tr("not set") : distribution[v].first)
+                          .arg(distribution[v].second));
+          if (distribution.size() > max_values)
+            values.append("...");
+
+          QTreeWidgetItem *item = new QTreeWidgetItem();
+          item->setText(0, table->column(varying[i]).path);
+          item->setText(1, QString::number(table->cardinality(varying[i])));
+          item->setText(2, values.join(", "));
+          items.append(item);
+        }
+      parameter_list->addTopLevelItems(items);
+      parameter_list->resizeColumnToContents(0);
+
+      QDialogButtonBox *buttons = new QDialogButtonBox(QDialogButtonBox::Close, Qt::Horizontal, this);
+      QPushButton *export_button = buttons->addButton(tr("Export CSV..."), QDialogButtonBox::ActionRole);
+      connect(export_button, SIGNAL(clicked()), this, SLOT(export_csv()));
+      connect(buttons, SIGNAL(rejected()), this, SLOT(reject()));
+
+      QVBoxLayout *layout = new QVBoxLayout(this);
+      layout->addWidget(summary_label);
+      layout->addWidget(parameter_list);
+      layout->addWidget(buttons);
+
+      resize(800, 500);
+    }
+
+
+
+    void AnalyticsDialog::export_csv()
+    {
+      const QString varying_item = tr("Parameters that differ");
+
+      bool ok = false;
+      const QString columns = QInputDialog::getItem(this, tr("Export CSV"),
+                                                    tr("Columns:"),
+                                                    QStringList() << varying_item
+                                                                  << tr("All parameters"),
+                                                    0, false, &ok);
+      if (!ok)
+        return;
+
+      const QString file_name =
+        QFileDialog::getSaveFileName(this, tr("Export CSV"),
+                                     QDir::currentPath(),
+                                     tr("CSV Files (*.csv)"));
+      if (file_name.isEmpty())
+        return;
+
+      QFile file(file_name);
+      if (!file.open(QFile::WriteOnly | QFile::Text))
+        {
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("Cannot write file %1:\n%2.")
+                                     .arg(file_name)
+                                     .arg(file.errorString()));
+          return;
+        }
+
+      QVector<int> exported;
+      if (columns == varying_item)
+        exported = table->varying_columns();
+      else
+        for (int c = 0; c < table->column_count(); ++c)
+          exported.append(c);
+
+      table->write_csv(&file, exported);
+    }
+  }
+}
@@ -0,0 +1,79 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef ANALYTICSDIALOG_H
+#define ANALYTICSDIALOG_H
+
+#include <QDialog>
+#include <QTreeWidget>
+
+#include "parameter_table.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The AnalyticsDialog class shows which parameters differ between the files of a
+     * @ref ParameterTable. Every parameter with more than one value is listed with the
+     * number of its distinct values, the parameters with the most values first, and
+     * with its values and the number of files they occur in. The table with these
+     * parameters, or with all of them, can be exported as CSV.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class AnalyticsDialog : public QDialog
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * Constructor. Shows the parameters of @p table, which must
+       * exist as long as the dialog.
+       */
+      AnalyticsDialog (const ParameterTable *table,
+                       QWidget *parent = 0);
+
+    private slots:
+      /**
+       * Ask for a file name and write the table as CSV.
+       */
+      void export_csv ();
+
+    private:
+      /**
+       * The table that is shown.
+       */
+      const ParameterTable *table;
+
+      /**
+       * The list of the varying parameters.
+       */
+      QTreeWidget *parameter_list;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -14,7 +14,9 @@
 // ---------------------------------------------------------------------
 
 #include "browse_lineedit.h"
+#include "directory_listing.h"
 
+#include <QAbstractItemView>
 #include <QHBoxLayout>
 
 namespace dealii
@@ -28,6 +30,14 @@ namespace dealii
       line_editor = new QLineEdit;
       connect(line_editor, SIGNAL(editingFinished()), this, SLOT(editing_finished()));
 
+      completion_model = new QStringListModel(this);
+      completer = new QCompleter(completion_model, this);
+      completer->setCompletionMode(QCompleter::PopupCompletion);
+      line_editor->setCompleter(completer);
+      connect(line_editor, SIGNAL(textEdited(const QString &)), this, SLOT(update_completions()));
+      connect(DirectoryListing::instance(), SIGNAL(listed(const QString &)),
+              this, SLOT(directory_listed(const QString &)));
+
       browse_button = new QPushButton("&Browse...");
       connect(browse_button, SIGNAL(clicked()), this, SLOT(browse()));
 
@@ -94,6 +104,70 @@ namespace dealii
 
 
 
+    void BrowseLineEdit::update_completions()
+    {
+      const QString text = line_editor->text();
+
+      // a list of files is completed at its last entry
+      int begin = (browse_type == files ? text.lastIndexOf(',') + 1 : 0);
+      while (begin < text.size() && text[begin] == ' ')
+        ++begin;
+
+      const QString entry = text.mid(begin);
+      const int name_begin = entry.lastIndexOf('/') + 1;
+
+      completion_base = text.left(begin + name_begin);
+      completion_prefix = entry.mid(name_begin);
+      completion_directory = directory_of(entry.left(name_begin));
+
+      // if the directory is not read yet, the completions
+      // are shown by directory_listed() once it is
+      if (DirectoryListing::instance()->list(completion_directory))
+        show_completions();
+    }
+
+
+
+    void BrowseLineEdit::directory_listed(const QString &directory)
+    {
+      if (directory == completion_directory && line_editor->hasFocus())
+        show_completions();
+    }
+
+
+
+    void BrowseLineEdit::show_completions()
+    {
+      const QStringList names =
+        DirectoryListing::instance()->complete(completion_directory,
+                                               completion_prefix,
+                                               browse_type == directory);
+
+      QStringList completions;
+      foreach (const QString &name, names)
+        completions.append(completion_base + name);
+
+      completion_model->setStringList(completions);
+
+      if (completions.isEmpty())
+        completer->popup()->hide();
+      else
+        {
+          completer->setCompletionPrefix(line_editor->text());
+          completer->complete();
+        }
+    }
+
+
+
+    QString BrowseLineEdit::directory_of(const QString &path)
+    {
+      // this does not access the filesystem
+      return QDir::cleanPath(QDir::current().absoluteFilePath(path));
+    }
+
+
+
     void BrowseLineEdit::browse()
     {
       QString  name = "";
@@ -21,6 +21,8 @@
 #include <QLineEdit>
 #include <QFileDialog>
 #include <QPushButton>
+#include <QCompleter>
+#include <QStringListModel>
 
 
 namespace dealii
@@ -38,6 +40,12 @@ namespace dealii
      * copies the path to the line editor. Depending on the <tt>BrowseType</tt> given in the constructor
      * the browse button opens a <tt>file</tt> or a <tt>directory</tt> dialog.
      *
+     * While a path is typed, the names in its directory that begin with the typed name
+     * are offered for completion. Relative paths are taken relative to the current
+     * directory. The directories are read in the background by the @ref DirectoryListing
+     * shared by all editors, so typing is never blocked by a slow filesystem and the
+     * completions are shown as soon as the directory is read.
+     *
      * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
      *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
      *
@@ -108,7 +116,31 @@ namespace dealii
        */
       void browse();
 
+      /**
+       * Determine the directory and the name to complete from the text of the line
+       * editor and show the completions if the directory was read before.
+       * This <tt>slot</tt> is called whenever the text is edited.
+       */
+      void update_completions();
+
+      /**
+       * Show the completions if @p directory is the one being completed.
+       */
+      void directory_listed(const QString &directory);
+
     private:
+      /**
+       * Show the names in <tt>completion_directory</tt> that
+       * begin with <tt>completion_prefix</tt>.
+       */
+      void show_completions();
+
+      /**
+       * Return the absolute path of the directory @p path, which is empty or ends
+       * with &quot;/&quot;, taking relative paths relative to the current directory.
+       */
+      static QString directory_of(const QString &path);
+
       /**
        * The line editor.
        */
@@ -118,6 +150,24 @@ namespace dealii
        * The browse button.
        */
       QPushButton *browse_button;
+
+      /**
+       * The completer of the line editor and its model.
+       */
+      QCompleter *completer;
+      QStringListModel *completion_model;
+
+      /**
+       * The absolute path of the directory the name being typed is completed in.
+       */
+      QString completion_directory;
+
+      /**
+       * The text of the line editor up to the name being typed, which is kept
+       * in the completions, and the part of the name typed so far.
+       */
+      QString completion_base;
+      QString completion_prefix;
     };
   }
   /**@}*/
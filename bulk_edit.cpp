@@ -0,0 +1,223 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#include "bulk_edit.h"
+#include "parameter_item.h"
+#include "parameter_pattern.h"
+
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // Append the parameters in the subtree of @p item to @p result,
+      // unless they are already in @p seen.
+      void collect_parameters (QTreeWidgetItem           *item,
+                               QSet<QTreeWidgetItem *>   &seen,
+                               QList<QTreeWidgetItem *>  &result)
+      {
+        if (item->childCount() == 0)
+          {
+            if (!seen.contains(item))
+              {
+                seen.insert(item);
+                result.append(item);
+              }
+          }
+        else
+          for (int i = 0; i < item->childCount(); ++i)
+            collect_parameters(item->child(i), seen, result);
+      }
+    }
+
+
+
+    BulkEdit::BulkEdit (QTreeWidget *tree_widget)
+            : tree_widget(tree_widget),
+              skipped(0)
+    {
+      signals_blocked = tree_widget->blockSignals(true);
+      model_signals_blocked = tree_widget->model()->blockSignals(true);
+    }
+
+
+
+    BulkEdit::~BulkEdit ()
+    {
+      QAbstractItemModel *model = tree_widget->model();
+      model->blockSignals(model_signals_blocked);
+
+      // the views, editors and selection models did not see the changes of the
+      // single items, tell them once; the changed rows have different parents,
+      // so no single dataChanged range covers them. Signals of models are
+      // protected in Qt 4, therefore they are invoked by name.
+      if (!changed.isEmpty() && !model_signals_blocked)
+        {
+          QMetaObject::invokeMethod(model, "layoutAboutToBeChanged");
+          QMetaObject::invokeMethod(model, "layoutChanged");
+        }
+
+      tree_widget->blockSignals(signals_blocked);
+    }
+
+
+
+    void BulkEdit::set_value (QTreeWidgetItem *item,
+                              const QString   &value)
+    {
+      const ParameterPattern pattern
+        = ParameterPattern::get(item->data(1,ParameterItem::pattern_description_role).toString());
+
+      if (!pattern.is_valid(value))
+        {
+          ++skipped;
+          return;
+        }
+
+      set_read_value(item, value);
+    }
+
+
+
+    void BulkEdit::set_read_value (QTreeWidgetItem *item,
+                                   const QString   &value)
+    {
+      const ParameterPattern pattern
+        = ParameterPattern::get(item->data(1,ParameterItem::pattern_description_role).toString());
+
+      bool ok = true;
+
+      switch (pattern.kind)
+        {
+          case ParameterPattern::integer:
+            {
+              const int number = value.toInt(&ok);
+              if (ok)
+                {
+                  set_data(item, number);
+                  return;
+                }
+              break;
+            }
+
+          case ParameterPattern::floating_point:
+            {
+              const double number = value.toDouble(&ok);
+              if (ok)
+                {
+                  set_data(item, number);
+                  return;
+                }
+              break;
+            }
+
+          case ParameterPattern::boolean:
+            if (value == "true" || value == "false")
+              {
+                set_data(item, value == "true");
+                return;
+              }
+            break;
+
+          default:
+            break;
+        }
+
+      set_data(item, value);
+    }
+
+
+
+    void BulkEdit::set_to_default (QTreeWidgetItem *item)
+    {
+      set_read_value(item, item->text(2));
+    }
+
+
+
+    void BulkEdit::scale (QTreeWidgetItem *item,
+                          const double     factor)
+    {
+      const ParameterPattern pattern
+        = ParameterPattern::get(item->data(1,ParameterItem::pattern_description_role).toString());
+
+      bool ok = true;
+      const double value = item->data(1,Qt::EditRole).toDouble(&ok);
+
+      if (!ok)
+        return;
+
+      // the editors do not accept values outside of the bounds either
+      if (pattern.kind == ParameterPattern::integer)
+        {
+          const double scaled = qBound<double>(pattern.min_integer,
+                                               value * factor,
+                                               pattern.max_integer);
+          set_data(item, qRound(scaled));
+        }
+      else if (pattern.kind == ParameterPattern::floating_point)
+        set_data(item, qBound(pattern.min_double, value * factor, pattern.max_double));
+    }
+
+
+
+    QList<QTreeWidgetItem *> BulkEdit::changed_items () const
+    {
+      return changed;
+    }
+
+
+
+    int BulkEdit::skipped_values () const
+    {
+      return skipped;
+    }
+
+
+
+    QList<QTreeWidgetItem *> BulkEdit::parameters (const QList<QTreeWidgetItem *> &items)
+    {
+      QSet<QTreeWidgetItem *> seen;
+      QList<QTreeWidgetItem *> result;
+
+      foreach (QTreeWidgetItem *item, items)
+        collect_parameters(item, seen, result);
+
+      return result;
+    }
+
+
+
+    void BulkEdit::set_data (QTreeWidgetItem *item,
+                             const QVariant  &value)
+    {
+      if (item->data(1,Qt::EditRole) == value)
+        return;
+
+      item->setData(1, Qt::EditRole, value);
+      ParameterItem::update_value(item);
+
+      if (!changed_set.contains(item))
+        {
+          changed_set.insert(item);
+          changed.append(item);
+        }
+    }
+  }
+}
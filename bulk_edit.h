@@ -0,0 +1,164 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#ifndef BULKEDIT_H
+#define BULKEDIT_H
+
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QTreeWidget>
+#include <QTreeWidgetItem>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The BulkEdit class changes the values of many parameters as one operation.
+     * While an object of this class exists, the signals of the tree and of its model are
+     * blocked, so the changes neither emit one <tt>itemChanged</tt> nor one
+     * <tt>dataChanged</tt> signal per parameter. The model of a QTreeWidget can not report
+     * changes of items in different subsections as one range, so instead the model
+     * emits <tt>layoutChanged</tt> once when the edit is finished. The changed parameters are collected and
+     * can be processed once with @ref changed_items after the edit is finished:
+     * @code
+     *   QList<QTreeWidgetItem *> changed;
+     *   {
+     *     BulkEdit edit(tree_widget);
+     *     foreach (QTreeWidgetItem *item, items)
+     *       edit.set_to_default(item);
+     *     changed = edit.changed_items();
+     *   }
+     * @endcode
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class BulkEdit
+    {
+    public:
+      /**
+       * Constructor. Block the signals of @p tree_widget.
+       */
+      BulkEdit (QTreeWidget *tree_widget);
+
+      /**
+       * Destructor. Restore the signals of the tree and let the
+       * model announce the changes once if parameters were changed.
+       */
+      ~BulkEdit ();
+
+      /**
+       * Set the value of the parameter @p item to @p value, if it satisfies the
+       * pattern of the parameter, like the editors of the @ref ParameterDelegate
+       * do. Values that do not are skipped and counted by @ref skipped_values.
+       */
+      void set_value (QTreeWidgetItem *item,
+                      const QString   &value);
+
+      /**
+       * Set the value of the parameter @p item to @p value as it was read from
+       * a file, without checking it against the pattern. The value is
+       * stored with the data type the pattern of the parameter asks for,
+       * as the @ref XMLParameterReader does.
+       */
+      void set_read_value (QTreeWidgetItem *item,
+                           const QString   &value);
+
+      /**
+       * Set the parameter @p item to its default value.
+       */
+      void set_to_default (QTreeWidgetItem *item);
+
+      /**
+       * Multiply the value of the parameter @p item by @p factor, if it is
+       * an &quot;Integer&quot; or &quot;Double&quot; parameter. Integers are rounded,
+       * and the results are clamped to the bounds of the pattern.
+       */
+      void scale (QTreeWidgetItem *item,
+                  const double     factor);
+
+      /**
+       * Store @p value as the value of the parameter @p item without converting it.
+       */
+      void set_data (QTreeWidgetItem *item,
+                     const QVariant  &value);
+
+      /**
+       * Return the parameters whose values were changed, each one once.
+       */
+      QList<QTreeWidgetItem *> changed_items () const;
+
+      /**
+       * Return the number of values @ref set_value skipped, since they
+       * did not satisfy the patterns of their parameters.
+       */
+      int skipped_values () const;
+
+      /**
+       * Return the parameters in @p items and in the subsections in @p items,
+       * each one once.
+       */
+      static QList<QTreeWidgetItem *> parameters (const QList<QTreeWidgetItem *> &items);
+
+    private:
+      /**
+       * Copying a BulkEdit would restore the signals twice.
+       */
+      BulkEdit (const BulkEdit &);
+      BulkEdit &operator = (const BulkEdit &);
+
+      /**
+       * The tree whose parameters are edited.
+       */
+      QTreeWidget *tree_widget;
+
+      /**
+       * Whether the signals of the tree were blocked before.
+       */
+      bool signals_blocked;
+
+      /**
+       * Whether the signals of the model of the tree were blocked before.
+       */
+      bool model_signals_blocked;
+
+      /**
+       * The changed parameters, in the order they were changed
+       * and as a set to find them quickly.
+       */
+      QList<QTreeWidgetItem *> changed;
+      QSet<QTreeWidgetItem *>  changed_set;
+
+      /**
+       * The number of values skipped by set_value().
+       */
+      int skipped;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -9,21 +9,77 @@ INCLUDEPATH += .
 DESTDIR = ../../lib/bin
 
 # Input
-HEADERS += browse_lineedit.h \
+HEADERS += analytics_dialog.h \
+           browse_lineedit.h \
+           bulk_edit.h \
+           directory_listing.h \
+           edit_journal.h \
+           edit_log.h \
            info_message.h \
+           go_to_dialog.h \
+           list_dialog.h \
+           list_editor.h \
            settings_dialog.h \
            mainwindow.h \
+           multiple_selection_dialog.h \
+           multiple_selection_editor.h \
            parameter_delegate.h \
+           parameter_filter.h \
+           parameter_item.h \
+           parameter_layers.h \
+           parameter_linter.h \
+           parameter_path_index.h \
+           parameter_pattern.h \
+           parameter_search_index.h \
+           parameter_sweep.h \
+           parameter_table.h \
+           parameter_value.h \
+           parameter_variants.h \
+           path_checker.h \
+           pattern_validator.h \
+           selection_editor.h \
+           string_pool.h \
+           xml_parameter_override.h \
            xml_parameter_reader.h \
            xml_parameter_writer.h \
+           xml_to_prm_converter.h \
+           prm_parameter_reader.h \
            prm_parameter_writer.h
-SOURCES += browse_lineedit.cpp \
+SOURCES += analytics_dialog.cpp \
+           browse_lineedit.cpp \
+           bulk_edit.cpp \
+           directory_listing.cpp \
+           edit_journal.cpp \
+           edit_log.cpp \
            info_message.cpp \
+           go_to_dialog.cpp \
+           list_dialog.cpp \
+           list_editor.cpp \
            settings_dialog.cpp \
            main.cpp \
            mainwindow.cpp \
+           multiple_selection_dialog.cpp \
+           multiple_selection_editor.cpp \
            parameter_delegate.cpp \
+           parameter_filter.cpp \
+           parameter_item.cpp \
+           parameter_layers.cpp \
+           parameter_linter.cpp \
+           parameter_path_index.cpp \
+           parameter_pattern.cpp \
+           parameter_search_index.cpp \
+           parameter_sweep.cpp \
+           parameter_table.cpp \
+           parameter_value.cpp \
+           parameter_variants.cpp \
+           path_checker.cpp \
+           pattern_validator.cpp \
+           selection_editor.cpp \
+           string_pool.cpp \
+           xml_parameter_override.cpp \
            xml_parameter_reader.cpp \
            xml_parameter_writer.cpp \
+           xml_to_prm_converter.cpp \
+           prm_parameter_reader.cpp \
            prm_parameter_writer.cpp
 RESOURCES += application.qrc
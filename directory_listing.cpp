@@ -0,0 +1,165 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "directory_listing.h"
+
+#include <QCoreApplication>
+#include <QDirIterator>
+#include <QMetaObject>
+#include <QPointer>
+#include <QRunnable>
+
+#include <algorithm>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // Reads a directory and hands the sorted names to the listing.
+      class ListJob : public QRunnable
+      {
+      public:
+        ListJob (DirectoryListing *listing,
+                 const QString    &directory)
+          : listing(listing),
+            directory(directory)
+        {
+        }
+
+        void run ()
+        {
+          QStringList names;
+
+          QDirIterator entries(directory, QDir::AllEntries | QDir::NoDotAndDotDot | QDir::Hidden);
+          while (entries.hasNext())
+            {
+              entries.next();
+
+              if (entries.fileInfo().isDir())
+                names.append(entries.fileName() + "/");
+              else
+                names.append(entries.fileName());
+            }
+
+          // complete() relies on the order of QString::operator<
+          std::sort(names.begin(), names.end());
+
+          // the listing waits for all jobs before it is destroyed
+          QMetaObject::invokeMethod(listing, "store_listing", Qt::QueuedConnection,
+                                    Q_ARG(QString, directory),
+                                    Q_ARG(QStringList, names));
+        }
+
+      private:
+        DirectoryListing  *listing;
+        QString            directory;
+      };
+    }
+
+
+
+    DirectoryListing::DirectoryListing(const int time_to_live,
+                                       QObject *parent)
+                    : QObject(parent),
+                      time_to_live(time_to_live)
+    {
+      clock.start();
+
+      // reading more directories at once does not help
+      // much if they are on the same disk
+      pool.setMaxThreadCount(2);
+    }
+
+
+
+    DirectoryListing::~DirectoryListing()
+    {
+      pool.waitForDone();
+    }
+
+
+
+    DirectoryListing *DirectoryListing::instance()
+    {
+      static QPointer<DirectoryListing> listing;
+
+      if (listing.isNull())
+        listing = new DirectoryListing(10000, QCoreApplication::instance());
+
+      return listing;
+    }
+
+
+
+    bool DirectoryListing::list(const QString &directory)
+    {
+      const QHash<QString, Listing>::const_iterator p = listings.constFind(directory);
+      const bool cached = (p != listings.constEnd());
+
+      if (!pending.contains(directory) &&
+          (!cached || clock.elapsed() - p.value().time >= time_to_live))
+        {
+          pending.insert(directory);
+          pool.start(new ListJob(this, directory));
+        }
+
+      return cached;
+    }
+
+
+
+    QStringList DirectoryListing::complete(const QString &directory,
+                                           const QString &prefix,
+                                           const bool     directories_only,
+                                           const int      max_names) const
+    {
+      QStringList completions;
+
+      const QHash<QString, Listing>::const_iterator p = listings.constFind(directory);
+      if (p == listings.constEnd())
+        return completions;
+
+      const QStringList &names = p.value().names;
+
+      // the names beginning with the prefix follow each other
+      // in the sorted list, starting at the first one not less
+      for (QStringList::const_iterator name = std::lower_bound(names.begin(), names.end(), prefix);
+           name != names.end() && name->startsWith(prefix) && completions.size() < max_names;
+           ++name)
+        if (!directories_only || name->endsWith('/'))
+          completions.append(*name);
+
+      return completions;
+    }
+
+
+
+    void DirectoryListing::store_listing(const QString     &directory,
+                                         const QStringList &names)
+    {
+      Listing listing;
+      listing.names = names;
+      listing.time = clock.elapsed();
+
+      listings.insert(directory, listing);
+      pending.remove(directory);
+
+      emit listed(directory);
+    }
+  }
+}
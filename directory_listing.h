@@ -0,0 +1,145 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef DIRECTORYLISTING_H
+#define DIRECTORYLISTING_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QThreadPool>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The DirectoryListing class lists the contents of directories in the background
+     * and caches them, to complete file and directory names while they are typed into
+     * a @ref BrowseLineEdit. Directories with tens of thousands of files take long to
+     * read, in particular on network filesystems, so they are never read in the thread
+     * of the GUI.
+     *
+     * A directory is read when it is requested by @ref list for the first time, or
+     * when its cached listing is older than <tt>time_to_live</tt> milliseconds. The
+     * signal @ref listed is emitted once it is read. The names in a listing are sorted,
+     * so @ref complete finds the names beginning with a prefix by binary search.
+     * All editors share the listings of the object returned by @ref instance.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class DirectoryListing : public QObject
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * Constructor. Listings are cached for @p time_to_live milliseconds.
+       */
+      DirectoryListing (const int time_to_live = 10000,
+                        QObject *parent = 0);
+
+      /**
+       * Destructor. Waits for the directories being read.
+       */
+      ~DirectoryListing ();
+
+      /**
+       * Return the listings shared by all editors. The object is
+       * destroyed together with the application.
+       */
+      static DirectoryListing *instance ();
+
+      /**
+       * Read @p directory in the background, unless a listing that is not expired
+       * is cached. Returns whether a listing, possibly expired, is cached.
+       */
+      bool list (const QString &directory);
+
+      /**
+       * Return at most @p max_names names in the cached listing of @p directory that
+       * begin with @p prefix. Names of subdirectories end with &quot;/&quot;. If
+       * @p directories_only is true, files are left out.
+       */
+      QStringList complete (const QString &directory,
+                            const QString &prefix,
+                            const bool     directories_only = false,
+                            const int      max_names = 100) const;
+
+    signals:
+      /**
+       * The contents of @p directory are read.
+       */
+      void listed (const QString &directory);
+
+    private slots:
+      /**
+       * Store the @p names in @p directory, called in the thread of this object
+       * when the directory is read.
+       */
+      void store_listing (const QString     &directory,
+                          const QStringList &names);
+
+    private:
+      /**
+       * A cached listing and the time it was read at.
+       */
+      struct Listing
+      {
+        QStringList  names;
+        qint64       time;
+      };
+
+      /**
+       * The time listings are cached for, in milliseconds.
+       */
+      int time_to_live;
+
+      /**
+       * The clock the times of the listings are measured with.
+       */
+      QElapsedTimer clock;
+
+      /**
+       * The listings by directory.
+       */
+      QHash<QString, Listing> listings;
+
+      /**
+       * The directories being read.
+       */
+      QSet<QString> pending;
+
+      /**
+       * The threads the directories are read in.
+       */
+      QThreadPool pool;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
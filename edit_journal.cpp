@@ -0,0 +1,183 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#include "edit_journal.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QtGlobal>
+
+#if QT_VERSION >= 0x050100
+#include <QLockFile>
+#endif
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // the first bytes of a journal file, "PGJ1"
+      const quint32 journal_magic = 0x50474a31;
+
+      // journals have to be readable by all Qt versions we support
+      const int stream_version = QDataStream::Qt_4_6;
+    }
+
+
+
+    EditJournal::EditJournal ()
+                : lock_file(0)
+    {
+    }
+
+
+
+    EditJournal::~EditJournal ()
+    {
+      flush();
+
+#if QT_VERSION >= 0x050100
+      delete lock_file;
+#endif
+    }
+
+
+
+    QString EditJournal::file_name (const QString &document)
+    {
+      return document + ".journal";
+    }
+
+
+
+    bool EditJournal::exists (const QString &document)
+    {
+      return QFile::exists(file_name(document));
+    }
+
+
+
+    QVector<EditJournal::Entry> EditJournal::read (const QString &document)
+    {
+      QVector<Entry> entries;
+
+      QFile file(file_name(document));
+      if (!file.open(QFile::ReadOnly))
+        return entries;
+
+      QDataStream in(&file);
+      in.setVersion(stream_version);
+
+      quint32 magic = 0;
+      in >> magic;
+      if (magic != journal_magic)
+        return entries;
+
+      while (!in.atEnd())
+        {
+          Entry entry;
+          in >> entry.path >> entry.value;
+
+          // the last record may be incomplete if the program crashed while writing it
+          if (in.status() != QDataStream::Ok)
+            break;
+
+          entries.append(entry);
+        }
+
+      return entries;
+    }
+
+
+
+    void EditJournal::open (const QString &document)
+    {
+      flush();
+      journal_file_name.clear();
+
+#if QT_VERSION >= 0x050100
+      delete lock_file;
+      lock_file = new QLockFile(file_name(document) + ".lock");
+
+      // another window records the changes of this document
+      if (!lock_file->tryLock(0))
+        {
+          delete lock_file;
+          lock_file = 0;
+          return;
+        }
+#endif
+
+      journal_file_name = file_name(document);
+    }
+
+
+
+    bool EditJournal::is_open () const
+    {
+      return !journal_file_name.isEmpty();
+    }
+
+
+
+    void EditJournal::remove ()
+    {
+      pending_records.clear();
+
+      if (!journal_file_name.isEmpty())
+        QFile::remove(journal_file_name);
+    }
+
+
+
+    void EditJournal::record (const QString  &path,
+                              const QVariant &value)
+    {
+      if (journal_file_name.isEmpty())
+        return;
+
+      QDataStream out(&pending_records, QIODevice::WriteOnly | QIODevice::Append);
+      out.setVersion(stream_version);
+      out << path << value;
+    }
+
+
+
+    void EditJournal::flush ()
+    {
+      if (pending_records.isEmpty() || journal_file_name.isEmpty())
+        return;
+
+      QFile file(journal_file_name);
+      if (!file.open(QFile::WriteOnly | QFile::Append))
+        return;
+
+      if (file.size() == 0)
+        {
+          QDataStream out(&file);
+          out.setVersion(stream_version);
+          out << journal_magic;
+        }
+
+      file.write(pending_records);
+      file.flush();
+
+      pending_records.clear();
+    }
+  }
+}
@@ -0,0 +1,151 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#ifndef EDITJOURNAL_H
+#define EDITJOURNAL_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+class QLockFile;
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The EditJournal class protects unsaved changes of a parameter file against crashes.
+     * Every change of a value is appended as a small record, the path of the parameter
+     * and its new value, to a journal file next to the document, see @ref file_name.
+     * Records are collected in memory by @ref record and appended to the file by
+     * @ref flush, which the caller should do shortly afterwards, e.g. with a timer, so
+     * a burst of changes causes only one write. When the document is saved or its
+     * changes are discarded, the journal is removed.
+     *
+     * If the program crashes, the journal is left behind. When the document is loaded
+     * again, the changes can be read with @ref read and applied again, which takes time
+     * proportional to the number of changes and not to the size of the document.
+     * A record that was only partially written is ignored.
+     *
+     * Only one window records the changes of a document: the journal is locked by
+     * @ref open, and a window that can not get the lock records nothing and must not
+     * recover or remove the journal, see @ref is_open. A lock left behind by a crashed
+     * program is taken over. Locking needs Qt 5.1 or later, with older versions
+     * windows on the same document share its journal.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class EditJournal
+    {
+    public:
+      /**
+       * A change in the journal.
+       */
+      struct Entry
+      {
+        QString   path;
+        QVariant  value;
+      };
+
+      /**
+       * Constructor. No document is opened.
+       */
+      EditJournal ();
+
+      /**
+       * Destructor. Write the records that were not flushed yet
+       * and release the lock of the journal.
+       */
+      ~EditJournal ();
+
+      /**
+       * Return the name of the journal file of @p document.
+       */
+      static QString file_name (const QString &document);
+
+      /**
+       * Return whether there is a journal for @p document.
+       */
+      static bool exists (const QString &document);
+
+      /**
+       * Read the changes in the journal of @p document in the order they were
+       * recorded. Returns an empty vector if there is no valid journal.
+       */
+      static QVector<Entry> read (const QString &document);
+
+      /**
+       * Start recording the changes of @p document, if no other window has its
+       * journal open. Changes that were recorded for another document before
+       * are flushed and its journal is released.
+       */
+      void open (const QString &document);
+
+      /**
+       * Return whether this object records the changes of a document, i.e. a
+       * document was opened and no other window had its journal open.
+       */
+      bool is_open () const;
+
+      /**
+       * Delete the journal file and the records that were not flushed yet.
+       * Further changes are still recorded.
+       */
+      void remove ();
+
+      /**
+       * Record that the value of the parameter with @p path was changed to @p value.
+       * Nothing is recorded unless the journal @ref is_open.
+       */
+      void record (const QString  &path,
+                   const QVariant &value);
+
+      /**
+       * Append the records collected since the last call to the journal file.
+       */
+      void flush ();
+
+    private:
+      /**
+       * The name of the journal file.
+       */
+      QString journal_file_name;
+
+      /**
+       * The records that were not written to the file yet.
+       */
+      QByteArray pending_records;
+
+      /**
+       * The lock of the journal file, held while it is open.
+       */
+      QLockFile *lock_file;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,130 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#include "edit_log.h"
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    EditLog::EditLog ()
+           : done_steps(0),
+             step_open(false)
+    {
+    }
+
+
+
+    void EditLog::clear ()
+    {
+      edits.clear();
+      step_begins.clear();
+      done_steps = 0;
+      step_open = false;
+    }
+
+
+
+    void EditLog::record (const int       id,
+                          const QVariant &old_value,
+                          const QVariant &new_value)
+    {
+      if (!step_open)
+        {
+          // a new step can not be followed by the steps that were undone
+          if (done_steps < step_begins.size())
+            {
+              edits.resize(step_begins[done_steps]);
+              step_begins.resize(done_steps);
+            }
+
+          step_begins.append(edits.size());
+          ++done_steps;
+          step_open = true;
+        }
+
+      Edit edit;
+      edit.id = id;
+      edit.old_value = old_value;
+      edit.new_value = new_value;
+      edits.append(edit);
+    }
+
+
+
+    void EditLog::finish_step ()
+    {
+      step_open = false;
+    }
+
+
+
+    bool EditLog::can_undo () const
+    {
+      return done_steps > 0;
+    }
+
+
+
+    bool EditLog::can_redo () const
+    {
+      return done_steps < step_begins.size();
+    }
+
+
+
+    QVector<EditLog::Edit> EditLog::undo ()
+    {
+      finish_step();
+      --done_steps;
+
+      QVector<Edit> result;
+      result.reserve(step_end(done_steps) - step_begins[done_steps]);
+
+      for (int i = step_end(done_steps)-1; i >= step_begins[done_steps]; --i)
+        result.append(edits[i]);
+
+      return result;
+    }
+
+
+
+    QVector<EditLog::Edit> EditLog::redo ()
+    {
+      finish_step();
+
+      QVector<Edit> result;
+      result.reserve(step_end(done_steps) - step_begins[done_steps]);
+
+      for (int i = step_begins[done_steps]; i < step_end(done_steps); ++i)
+        result.append(edits[i]);
+
+      ++done_steps;
+      return result;
+    }
+
+
+
+    int EditLog::step_end (const int step) const
+    {
+      if (step+1 < step_begins.size())
+        return step_begins[step+1];
+      else
+        return edits.size();
+    }
+  }
+}
@@ -0,0 +1,135 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#ifndef EDITLOG_H
+#define EDITLOG_H
+
+#include <QVariant>
+#include <QVector>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The EditLog class records the changes of parameter values for undo and redo.
+     * Every change is stored as the id of the parameter, see @ref ParameterPathIndex,
+     * its old and its new value, so the memory needed grows with the number of
+     * changes and not with the size of the parameter file. Changes are grouped into
+     * steps: all changes recorded until @ref finish_step is called are undone and
+     * redone together, e.g. the changes of a @ref BulkEdit.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class EditLog
+    {
+    public:
+      /**
+       * A change of the value of one parameter.
+       */
+      struct Edit
+      {
+        int       id;
+        QVariant  old_value;
+        QVariant  new_value;
+      };
+
+      /**
+       * Constructor.
+       */
+      EditLog ();
+
+      /**
+       * Remove all steps.
+       */
+      void clear ();
+
+      /**
+       * Record that the value of parameter @p id changed from @p old_value to @p new_value.
+       * The change is added to the current step. The first change of a new step discards
+       * all steps that were undone.
+       */
+      void record (const int       id,
+                   const QVariant &old_value,
+                   const QVariant &new_value);
+
+      /**
+       * Finish the current step. The next change starts a new one.
+       */
+      void finish_step ();
+
+      /**
+       * Return whether there is a step to undo.
+       */
+      bool can_undo () const;
+
+      /**
+       * Return whether there is a step to redo.
+       */
+      bool can_redo () const;
+
+      /**
+       * Return the changes of the last step that was done, in the order in which they have to
+       * be reverted, and mark it as undone. Must only be called if @ref can_undo is true.
+       */
+      QVector<Edit> undo ();
+
+      /**
+       * Return the changes of the first step that was undone, in the order in which they have
+       * to be applied, and mark it as done. Must only be called if @ref can_redo is true.
+       */
+      QVector<Edit> redo ();
+
+    private:
+      /**
+       * Return the position of the first change after step @p step in <tt>edits</tt>.
+       */
+      int step_end (const int step) const;
+
+      /**
+       * The changes of all steps, in the order they were recorded.
+       */
+      QVector<Edit> edits;
+
+      /**
+       * The position of the first change of each step in <tt>edits</tt>.
+       */
+      QVector<int> step_begins;
+
+      /**
+       * The number of steps that are done. The steps after them were undone.
+       */
+      int done_steps;
+
+      /**
+       * Whether changes are added to the last step.
+       */
+      bool step_open;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,104 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "go_to_dialog.h"
+
+#include <QCoreApplication>
+#include <QKeyEvent>
+#include <QVBoxLayout>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    GoToDialog::GoToDialog(const ParameterPathIndex *path_index,
+                           QWidget *parent)
+              : QDialog(parent, 0),
+                path_index(path_index)
+    {
+      setWindowTitle(tr("Go to parameter"));
+
+      line_editor = new QLineEdit(this);
+      line_editor->installEventFilter(this);
+      connect(line_editor, SIGNAL(textChanged(const QString &)), this, SLOT(update_matches(const QString &)));
+      connect(line_editor, SIGNAL(returnPressed()), this, SLOT(accept()));
+
+      matches = new QListWidget(this);
+      matches->setFocusPolicy(Qt::NoFocus);
+      connect(matches, SIGNAL(itemActivated(QListWidgetItem *)), this, SLOT(accept()));
+
+      QVBoxLayout *layout = new QVBoxLayout(this);
+      layout->addWidget(line_editor);
+      layout->addWidget(matches);
+
+      resize(600, 400);
+    }
+
+
+
+    int GoToDialog::selected_id() const
+    {
+      const QListWidgetItem * item = matches->currentItem();
+
+      if (item)
+        return item->data(Qt::UserRole).toInt();
+      else
+        return -1;
+    }
+
+
+
+    bool GoToDialog::eventFilter(QObject *object, QEvent *event)
+    {
+      if (object == line_editor && event->type() == QEvent::KeyPress)
+        {
+          const QKeyEvent * key_event = static_cast<QKeyEvent *>(event);
+
+          if (key_event->key() == Qt::Key_Up || key_event->key() == Qt::Key_Down ||
+              key_event->key() == Qt::Key_PageUp || key_event->key() == Qt::Key_PageDown)
+            {
+              QCoreApplication::sendEvent(matches, event);
+              return true;
+            }
+        }
+
+      return QDialog::eventFilter(object, event);
+    }
+
+
+
+    void GoToDialog::update_matches(const QString &text)
+    {
+      matches->clear();
+
+      if (text.isEmpty())
+        return;
+
+      // nobody reads through more matches than this
+      const int max_matches = 50;
+      const QVector<int> ids = path_index->fuzzy_matches(text, max_matches);
+
+      for (int i = 0; i < ids.size(); ++i)
+        {
+          QListWidgetItem * item = new QListWidgetItem(path_index->path(ids[i]), matches);
+          item->setData(Qt::UserRole, ids[i]);
+        }
+
+      if (matches->count() > 0)
+        matches->setCurrentRow(0);
+    }
+  }
+}
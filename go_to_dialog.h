@@ -0,0 +1,95 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef GOTODIALOG_H
+#define GOTODIALOG_H
+
+#include <QDialog>
+#include <QLineEdit>
+#include <QListWidget>
+
+#include "parameter_path_index.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The GoToDialog class implements a small dialog for jumping to a parameter by its path.
+     * While the user types, the dialog lists the paths that match the typed text best
+     * according to @ref ParameterPathIndex::fuzzy_matches. The arrow keys select a path,
+     * and the Enter key or a double click accept it.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class GoToDialog : public QDialog
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * Constructor. The paths are looked up in @p path_index.
+       */
+      GoToDialog (const ParameterPathIndex *path_index,
+                  QWidget *parent = 0);
+
+      /**
+       * Return the id of the selected item in the path index, or -1 if none is selected.
+       */
+      int selected_id () const;
+
+    protected:
+      /**
+       * Reimplemented from QObject. Forwards the arrow keys from
+       * the line editor to the list of matches.
+       */
+      bool eventFilter (QObject *object, QEvent *event);
+
+    private slots:
+      /**
+       * Show the paths that match @p text.
+       */
+      void update_matches (const QString &text);
+
+    private:
+      /**
+       * The index the paths are looked up in.
+       */
+      const ParameterPathIndex *path_index;
+
+      /**
+       * The line editor for the path.
+       */
+      QLineEdit *line_editor;
+
+      /**
+       * The list of matching paths. The id of each path is stored as user data.
+       */
+      QListWidget *matches;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
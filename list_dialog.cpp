@@ -0,0 +1,356 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "list_dialog.h"
+
+#include <QAbstractTableModel>
+#include <QColor>
+#include <QDialogButtonBox>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QItemSelectionModel>
+#include <QPushButton>
+#include <QVBoxLayout>
+
+#include <algorithm>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // the number of elements split from the value at once
+      const int elements_per_chunk = 1000;
+
+
+
+      // Return the leading white space of @p s.
+      QString leading_space (const QString &s)
+      {
+        int n = 0;
+        while (n < s.size() && s[n].isSpace())
+          ++n;
+
+        return s.left(n);
+      }
+    }
+
+
+
+    /**
+     * The model of the table. It stores the elements split from the value so far
+     * as they were written, including white space, so elements that are not edited
+     * are put back unchanged. The rest of the value is split when the table is
+     * scrolled to its end.
+     */
+    class ListDialog::ElementModel : public QAbstractTableModel
+    {
+    public:
+      ElementModel (const ParameterPattern &pattern,
+                    const QString          &value,
+                    QObject                *parent)
+        : QAbstractTableModel(parent),
+          pattern(pattern),
+          element_pattern(ParameterPattern::get(pattern.element_description)),
+          value_pattern(ParameterPattern::get(pattern.value_description)),
+          text(value),
+          split_to(0),
+          split_all(value.trimmed().isEmpty())
+      {
+        split_chunk();
+      }
+
+      int rowCount (const QModelIndex &parent = QModelIndex()) const
+      {
+        return parent.isValid() ? 0 : elements.size();
+      }
+
+      int columnCount (const QModelIndex &parent = QModelIndex()) const
+      {
+        if (parent.isValid())
+          return 0;
+
+        return (pattern.kind == ParameterPattern::map) ? 2 : 1;
+      }
+
+      QVariant data (const QModelIndex &index, int role) const
+      {
+        if (!index.isValid())
+          return QVariant();
+
+        const QString part = part_of(elements[index.row()], index.column());
+        const ParameterPattern &part_pattern = (index.column() == 0 ? element_pattern : value_pattern);
+
+        switch (role)
+          {
+            case Qt::DisplayRole:
+            case Qt::EditRole:
+              return part.trimmed();
+
+            // elements are only checked when they are shown
+            case Qt::ForegroundRole:
+              if (!part_pattern.is_valid(part.trimmed()))
+                return QColor(Qt::red);
+              return QVariant();
+
+            case Qt::ToolTipRole:
+              if (!part_pattern.is_valid(part.trimmed()))
+                return tr("The value does not match the pattern %1.")
+                       .arg(index.column() == 0 ? pattern.element_description : pattern.value_description);
+              return QVariant();
+
+            default:
+              return QVariant();
+          }
+      }
+
+      bool setData (const QModelIndex &index, const QVariant &data, int role = Qt::EditRole)
+      {
+        if (!index.isValid() || role != Qt::EditRole)
+          return false;
+
+        QString &element = elements[index.row()];
+
+        // keep the white space the element was written with
+        if (pattern.kind == ParameterPattern::map)
+          {
+            const QString key = part_of(element, 0),
+                          value = part_of(element, 1);
+
+            if (index.column() == 0)
+              element = leading_space(key) + data.toString() + pattern.key_value_separator + value;
+            else
+              element = key + pattern.key_value_separator + leading_space(value) + data.toString();
+          }
+        else
+          element = leading_space(element) + data.toString();
+
+        emit dataChanged(index, index);
+        return true;
+      }
+
+      Qt::ItemFlags flags (const QModelIndex &index) const
+      {
+        return QAbstractTableModel::flags(index) | Qt::ItemIsEditable;
+      }
+
+      QVariant headerData (int section, Qt::Orientation orientation, int role) const
+      {
+        if (orientation == Qt::Horizontal && role == Qt::DisplayRole)
+          {
+            if (pattern.kind != ParameterPattern::map)
+              return tr("Element");
+            else
+              return (section == 0) ? tr("Key") : tr("Value");
+          }
+
+        return QAbstractTableModel::headerData(section, orientation, role);
+      }
+
+      bool canFetchMore (const QModelIndex &parent) const
+      {
+        return !parent.isValid() && !split_all;
+      }
+
+      void fetchMore (const QModelIndex &parent)
+      {
+        if (parent.isValid() || split_all)
+          return;
+
+        const int first = elements.size();
+        QVector<QString> chunk;
+        split_chunk(&chunk);
+
+        if (chunk.isEmpty())
+          return;
+
+        beginInsertRows(QModelIndex(), first, first + chunk.size() - 1);
+        elements += chunk;
+        endInsertRows();
+      }
+
+      void insert_element (const int row)
+      {
+        beginInsertRows(QModelIndex(), row, row);
+        elements.insert(row, (pattern.kind == ParameterPattern::map) ? pattern.key_value_separator : QString());
+        endInsertRows();
+      }
+
+      void remove_element (const int row)
+      {
+        beginRemoveRows(QModelIndex(), row, row);
+        elements.remove(row);
+        endRemoveRows();
+      }
+
+      QString value () const
+      {
+        QString result;
+
+        for (int i=0; i<elements.size(); ++i)
+          {
+            if (i > 0)
+              result += pattern.list_separator;
+            result += elements[i];
+          }
+
+        // the rest of the value was not split, so it is still as it was written
+        if (!split_all)
+          {
+            if (!elements.isEmpty())
+              result += pattern.list_separator;
+            result += text.midRef(split_to);
+          }
+
+        return result;
+      }
+
+    private:
+      // Split up to elements_per_chunk elements from the value, and append them
+      // to @p chunk or, if it is zero, to the elements. This is done before the
+      // model is shown the first time and whenever the view fetches more rows.
+      void split_chunk (QVector<QString> *chunk = 0)
+      {
+        QVector<QString> &target = (chunk ? *chunk : elements);
+
+        for (int n = 0; n < elements_per_chunk && !split_all; ++n)
+          {
+            const int end = text.indexOf(pattern.list_separator, split_to);
+
+            if (end == -1)
+              {
+                target.append(text.mid(split_to));
+                split_all = true;
+              }
+            else
+              {
+                target.append(text.mid(split_to, end - split_to));
+                split_to = end + pattern.list_separator.size();
+              }
+          }
+      }
+
+      // Return the key (column 0) or the value (column 1) of the element of a map,
+      // or the element itself for lists.
+      QString part_of (const QString &element,
+                       const int      column) const
+      {
+        if (pattern.kind != ParameterPattern::map)
+          return element;
+
+        const int separator = element.indexOf(pattern.key_value_separator);
+        if (separator == -1)
+          return (column == 0) ? element : QString();
+
+        return (column == 0)
+               ? element.left(separator)
+               : element.mid(separator + pattern.key_value_separator.size());
+      }
+
+      const ParameterPattern pattern;
+      const ParameterPattern element_pattern;
+      const ParameterPattern value_pattern;
+
+      // the value, the position up to which it is split,
+      // and whether it is split completely
+      const QString text;
+      int split_to;
+      bool split_all;
+
+      QVector<QString> elements;
+    };
+
+
+
+    ListDialog::ListDialog(const ParameterPattern &pattern,
+                           const QString          &value,
+                           QWidget                *parent)
+              : QDialog(parent)
+    {
+      setWindowTitle(pattern.kind == ParameterPattern::map ? tr("Edit Map") : tr("Edit List"));
+
+      element_model = new ElementModel(pattern, value, this);
+
+      table_view = new QTableView(this);
+      table_view->setModel(element_model);
+      table_view->setSelectionBehavior(QAbstractItemView::SelectRows);
+      table_view->horizontalHeader()->setStretchLastSection(true);
+
+      QPushButton *add_button = new QPushButton(tr("&Add"), this);
+      connect(add_button, SIGNAL(clicked()), this, SLOT(add_element()));
+
+      QPushButton *remove_button = new QPushButton(tr("&Remove"), this);
+      connect(remove_button, SIGNAL(clicked()), this, SLOT(remove_elements()));
+
+      QDialogButtonBox *button_box = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, Qt::Horizontal, this);
+      connect(button_box, SIGNAL(accepted()), this, SLOT(accept()));
+      connect(button_box, SIGNAL(rejected()), this, SLOT(reject()));
+
+      QHBoxLayout *buttons = new QHBoxLayout;
+      buttons->addWidget(add_button);
+      buttons->addWidget(remove_button);
+      buttons->addStretch();
+      buttons->addWidget(button_box);
+
+      QVBoxLayout *layout = new QVBoxLayout;
+      layout->addWidget(table_view);
+      layout->addLayout(buttons);
+      setLayout(layout);
+
+      resize(500, 600);
+    }
+
+
+
+    QString ListDialog::value() const
+    {
+      return element_model->value();
+    }
+
+
+
+    void ListDialog::add_element()
+    {
+      const QModelIndex current = table_view->currentIndex();
+
+      // without a current element, insert before the first one, since
+      // the end of the list may not be split from the value yet
+      const int row = current.isValid() ? current.row() + 1 : 0;
+
+      element_model->insert_element(row);
+
+      table_view->setCurrentIndex(element_model->index(row, 0));
+      table_view->edit(table_view->currentIndex());
+    }
+
+
+
+    void ListDialog::remove_elements()
+    {
+      const QModelIndexList selected = table_view->selectionModel()->selectedRows();
+
+      QList<int> rows;
+      foreach (const QModelIndex &index, selected)
+        rows.append(index.row());
+
+      // remove from the back, so the rows in front keep their positions
+      std::sort(rows.begin(), rows.end());
+      for (int i=rows.size()-1; i>=0; --i)
+        element_model->remove_element(rows[i]);
+    }
+  }
+}
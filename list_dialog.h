@@ -0,0 +1,95 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef LISTDIALOG_H
+#define LISTDIALOG_H
+
+#include <QDialog>
+#include <QTableView>
+
+#include "parameter_pattern.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ListDialog class shows the elements of a &quot;List&quot; or the keys and
+     * values of a &quot;Map&quot; parameter in a table, one element per row. Lists of
+     * boundary ids, time points or coefficients may have tens of thousands of elements,
+     * which are hard to edit in a single line. The value is split into elements in chunks
+     * while the table is scrolled, so opening the dialog only takes the time to split
+     * the first rows. Elements are checked against the pattern of the elements when they
+     * are shown, and invalid ones are shown in red. Editing an element only changes this
+     * element, the value is put together again by @ref value when the dialog is accepted.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ListDialog : public QDialog
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * Constructor. Shows the elements of @p value, which is a value of a parameter with @p pattern.
+       */
+      ListDialog (const ParameterPattern &pattern,
+                  const QString          &value,
+                  QWidget                *parent = 0);
+
+      /**
+       * Return the value with the edited elements. Elements that
+       * were not split from the value yet are appended unchanged.
+       */
+      QString value () const;
+
+    private slots:
+      /**
+       * Insert an empty element after the current one.
+       */
+      void add_element ();
+
+      /**
+       * Remove the selected elements.
+       */
+      void remove_elements ();
+
+    private:
+      class ElementModel;
+
+      /**
+       * The table of the elements.
+       */
+      QTableView *table_view;
+
+      /**
+       * The model of the table.
+       */
+      ElementModel *element_model;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,117 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "list_editor.h"
+#include "list_dialog.h"
+
+#include <QHBoxLayout>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    ListEditor::ListEditor(QWidget *parent)
+              : QFrame(parent, 0)
+    {
+      line_editor = new QLineEdit;
+      connect(line_editor, SIGNAL(editingFinished()), this, SLOT(editing_finished()));
+
+      table_button = new QPushButton(tr("&Table..."));
+      connect(table_button, SIGNAL(clicked()), this, SLOT(edit_elements()));
+
+      setFocusPolicy (Qt::StrongFocus);
+
+      QHBoxLayout *layout = new QHBoxLayout;
+
+      layout->setContentsMargins(1,1,1,1);
+      layout->addWidget(line_editor);
+      layout->addWidget(table_button);
+      setLayout(layout);
+
+      setAutoFillBackground(true);
+      setBackgroundRole(QPalette::Highlight);
+    }
+
+
+
+    QSize ListEditor::sizeHint() const
+    {
+      QSize  size_line_editor  = line_editor->sizeHint(),
+             size_table_button = table_button->sizeHint();
+
+      int w = size_line_editor.rwidth() + size_table_button.rwidth(),
+          h = qMax(size_line_editor.rheight(), size_table_button.rheight());
+
+      return QSize (w, h);
+    }
+
+
+
+    QSize ListEditor::minimumSizeHint() const
+    {
+      QSize  size_line_editor  = line_editor->minimumSizeHint(),
+             size_table_button = table_button->minimumSizeHint();
+
+      int w = size_line_editor.rwidth() + size_table_button.rwidth(),
+          h = qMax(size_line_editor.rheight(), size_table_button.rheight());
+
+      return QSize (w, h);
+    }
+
+
+
+    void ListEditor::set_pattern(const ParameterPattern &new_pattern)
+    {
+      pattern = new_pattern;
+    }
+
+
+
+    QString ListEditor::text() const
+    {
+      return line_editor->text();
+    }
+
+
+
+    void ListEditor::setText(const QString &str)
+    {
+      line_editor->setText(str);
+    }
+
+
+
+    void ListEditor::editing_finished()
+    {
+      emit editingFinished();
+    }
+
+
+
+    void ListEditor::edit_elements()
+    {
+      // the dialog is a child of the editor, so the
+      // delegate does not close the editor when it opens
+      ListDialog dialog(pattern, line_editor->text(), this);
+
+      if (dialog.exec() == QDialog::Accepted)
+        {
+          line_editor->setText(dialog.value());
+          emit editingFinished();
+        }
+    }
+  }
+}
@@ -0,0 +1,121 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef LISTEDITOR_H
+#define LISTEDITOR_H
+
+#include <QFrame>
+#include <QLineEdit>
+#include <QPushButton>
+
+#include "parameter_pattern.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ListEditor class provides the editor for &quot;List&quot; and &quot;Map&quot;
+     * parameters. Short values can be edited in its line editor. For long values the
+     * button opens a @ref ListDialog, which shows the elements in a table and only
+     * splits as much of the value as is shown.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ListEditor : public QFrame
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * Constructor.
+       */
+      ListEditor (QWidget *parent = 0);
+
+      /**
+       * Reimplemented from the QWidget class.
+       * Returns the size of the editor.
+       */
+      QSize  sizeHint() const;
+
+      /**
+       * Reimplemented from the QWidget class.
+       */
+      QSize  minimumSizeHint() const;
+
+      /**
+       * Edit values of parameters with @p pattern.
+       */
+      void set_pattern (const ParameterPattern &pattern);
+
+      /**
+       * Returns the text of the line editor.
+       */
+      QString  text() const;
+
+    public slots:
+      /**
+       * A <tt>slot</tt> to set @p str as text of the line editor.
+       */
+      void setText(const QString &str);
+
+    signals:
+      /**
+       * This <tt>signal</tt> will be emitted, if editing is finished
+       * or the table of elements is accepted.
+       */
+      void editingFinished();
+
+    private slots:
+      /**
+       * This <tt>slot</tt> should be always called, if editing is finished.
+       */
+      void editing_finished();
+
+      /**
+       * Open a @ref ListDialog with the elements of the value.
+       */
+      void edit_elements();
+
+    private:
+      /**
+       * The pattern of the parameter.
+       */
+      ParameterPattern pattern;
+
+      /**
+       * The line editor.
+       */
+      QLineEdit *line_editor;
+
+      /**
+       * The button that opens the table of elements.
+       */
+      QPushButton *table_button;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -15,10 +15,258 @@
 
 
 #include <QApplication>
+#include <QCoreApplication>
+#include <QFile>
 #include <QSplashScreen>
+#include <QTextStream>
 #include <QTimer>
 
 #include "mainwindow.h"
+#include "parameter_linter.h"
+#include "parameter_table.h"
+#include "xml_parameter_override.h"
+#include "xml_to_prm_converter.h"
+
+
+namespace
+{
+  // Apply overrides to a parameter file without loading it into a tree:
+  //   parameter_gui --override <input.xml> <output.xml> <path>=<value> ...
+  int override_values(const QStringList &arguments)
+  {
+    QTextStream err(stderr);
+
+    if (arguments.size() < 4)
+      {
+        err << "Usage: " << arguments[0]
+            << " --override <input.xml> <output.xml> <path>=<value> ...\n";
+        return 1;
+      }
+
+    QHash<QString, QString> overrides;
+    for (int i = 4; i < arguments.size(); ++i)
+      {
+        const int separator = arguments[i].indexOf('=');
+        if (separator == -1)
+          {
+            err << "Invalid override " << arguments[i] << ", expected <path>=<value>\n";
+            return 1;
+          }
+
+        overrides.insert(arguments[i].left(separator), arguments[i].mid(separator+1));
+      }
+
+    QFile input(arguments[2]), output(arguments[3]);
+
+    if (!input.open(QFile::ReadOnly))
+      {
+        err << "Cannot read file " << arguments[2] << ": " << input.errorString() << "\n";
+        return 1;
+      }
+
+    if (!output.open(QFile::WriteOnly))
+      {
+        err << "Cannot write file " << arguments[3] << ": " << output.errorString() << "\n";
+        return 1;
+      }
+
+    dealii::ParameterGui::XMLParameterOverride xml_override(overrides);
+
+    if (!xml_override.apply(&input, &output))
+      {
+        err << "Parse error in file " << arguments[2] << ":\n" << xml_override.error_string() << "\n";
+        return 1;
+      }
+
+    const QStringList unmatched = xml_override.unmatched_paths();
+    foreach (const QString &path, unmatched)
+      err << "No parameter " << path << " in file " << arguments[2] << "\n";
+
+    return unmatched.isEmpty() ? 0 : 1;
+  }
+
+
+
+  // Convert a parameter file to the PRM format without loading it into a tree:
+  //   parameter_gui --to-prm <input.xml> <output.prm>
+  int convert_to_prm(const QStringList &arguments)
+  {
+    QTextStream err(stderr);
+
+    if (arguments.size() != 4)
+      {
+        err << "Usage: " << arguments[0] << " --to-prm <input.xml> <output.prm>\n";
+        return 1;
+      }
+
+    QFile input(arguments[2]), output(arguments[3]);
+
+    if (!input.open(QFile::ReadOnly))
+      {
+        err << "Cannot read file " << arguments[2] << ": " << input.errorString() << "\n";
+        return 1;
+      }
+
+    if (!output.open(QFile::WriteOnly | QFile::Text))
+      {
+        err << "Cannot write file " << arguments[3] << ": " << output.errorString() << "\n";
+        return 1;
+      }
+
+    dealii::ParameterGui::XMLToPRMConverter converter;
+
+    if (!converter.convert(&input, &output))
+      {
+        err << "Parse error in file " << arguments[2] << ":\n" << converter.error_string() << "\n";
+        return 1;
+      }
+
+    return 0;
+  }
+
+
+
+  // Check many parameter files at once and write a report in XML format:
+  //   parameter_gui --lint [--schema <schema.xml>] [--report <report.xml>] <file or directory> ...
+  int lint_files(const QStringList &arguments)
+  {
+    QTextStream err(stderr);
+
+    QString schema_file, report_file;
+    QStringList paths;
+
+    for (int i = 2; i < arguments.size(); ++i)
+      if ((arguments[i] == "--schema" || arguments[i] == "--report") && i+1 < arguments.size())
+        {
+          (arguments[i] == "--schema" ? schema_file : report_file) = arguments[i+1];
+          ++i;
+        }
+      else
+        paths.append(arguments[i]);
+
+    if (paths.isEmpty())
+      {
+        err << "Usage: " << arguments[0]
+            << " --lint [--schema <schema.xml>] [--report <report.xml>] <file or directory> ...\n";
+        return 1;
+      }
+
+    dealii::ParameterGui::ParameterLinter linter;
+
+    if (!schema_file.isEmpty())
+      {
+        QFile schema(schema_file);
+
+        if (!schema.open(QFile::ReadOnly))
+          {
+            err << "Cannot read file " << schema_file << ": " << schema.errorString() << "\n";
+            return 1;
+          }
+
+        if (!linter.set_schema(&schema))
+          {
+            err << "Parse error in file " << schema_file << ":\n" << linter.error_string() << "\n";
+            return 1;
+          }
+      }
+
+    const QVector<dealii::ParameterGui::ParameterLinter::FileReport>
+      reports = linter.lint(dealii::ParameterGui::ParameterLinter::parameter_files(paths));
+
+    // without a file name the report is written to the standard output
+    QFile report(report_file);
+    const bool opened = (report_file.isEmpty()
+                         ? report.open(stdout, QFile::WriteOnly)
+                         : report.open(QFile::WriteOnly | QFile::Text));
+    if (!opened)
+      {
+        err << "Cannot write file " << report_file << ": " << report.errorString() << "\n";
+        return 1;
+      }
+
+    dealii::ParameterGui::ParameterLinter::write_report(reports, &report);
+
+    int files_with_problems = 0;
+    for (int i = 0; i < reports.size(); ++i)
+      if (!reports[i].error.isEmpty() || !reports[i].issues.isEmpty())
+        ++files_with_problems;
+
+    err << reports.size() << " files checked, " << files_with_problems << " with problems\n";
+
+    return files_with_problems == 0 ? 0 : 1;
+  }
+
+
+
+  // List the parameters that differ between many parameter files:
+  //   parameter_gui --analyze [--csv <table.csv>] [--all] <file or directory> ...
+  int analyze_files(const QStringList &arguments)
+  {
+    QTextStream err(stderr), out(stdout);
+
+    QString csv_file;
+    bool all_columns = false;
+    QStringList paths;
+
+    for (int i = 2; i < arguments.size(); ++i)
+      if (arguments[i] == "--csv" && i+1 < arguments.size())
+        csv_file = arguments[++i];
+      else if (arguments[i] == "--all")
+        all_columns = true;
+      else
+        paths.append(arguments[i]);
+
+    if (paths.isEmpty())
+      {
+        err << "Usage: " << arguments[0]
+            << " --analyze [--csv <table.csv>] [--all] <file or directory> ...\n";
+        return 1;
+      }
+
+    dealii::ParameterGui::ParameterTable table;
+    table.load(dealii::ParameterGui::ParameterLinter::parameter_files(paths));
+
+    foreach (const QString &error, table.errors())
+      err << error << "\n";
+
+    // one line per varying parameter: the number of values, the path
+    // and the values with the number of files they occur in
+    const QVector<int> varying = table.varying_columns();
+    for (int i = 0; i < varying.size(); ++i)
+      {
+        const QVector<QPair<QString, int> > distribution = table.distribution(varying[i]);
+
+        out << table.cardinality(varying[i]) << "\t" << table.column(varying[i]).path;
+        for (int v = 0; v < distribution.size(); ++v)
+          out << "\t" << (distribution[v].first.isNull() ? QString("<not set>") : distribution[v].first)
+              << " (" << distribution[v].second << ")";
+        out << "\n";
+      }
+
+    if (!csv_file.isEmpty())
+      {
+        QFile csv(csv_file);
+
+        if (!csv.open(QFile::WriteOnly | QFile::Text))
+          {
+            err << "Cannot write file " << csv_file << ": " << csv.errorString() << "\n";
+            return 1;
+          }
+
+        QVector<int> columns = varying;
+        if (all_columns)
+          {
+            columns.clear();
+            for (int c = 0; c < table.column_count(); ++c)
+              columns.append(c);
+          }
+
+        table.write_csv(&csv, columns);
+      }
+
+    return table.errors().isEmpty() ? 0 : 1;
+  }
+}
 
 /*! @addtogroup ParameterGui
  *@{
@@ -49,6 +297,31 @@ int main(int argc, char *argv[])
   // init resources such as icons or graphics
   Q_INIT_RESOURCE(application);
 
+  // command line tools do not need a window
+  if (argc > 1 && QString(argv[1]) == "--override")
+    {
+      QCoreApplication app(argc, argv);
+      return override_values(app.arguments());
+    }
+
+  if (argc > 1 && QString(argv[1]) == "--to-prm")
+    {
+      QCoreApplication app(argc, argv);
+      return convert_to_prm(app.arguments());
+    }
+
+  if (argc > 1 && QString(argv[1]) == "--lint")
+    {
+      QCoreApplication app(argc, argv);
+      return lint_files(app.arguments());
+    }
+
+  if (argc > 1 && QString(argv[1]) == "--analyze")
+    {
+      QCoreApplication app(argc, argv);
+      return analyze_files(app.arguments());
+    }
+
   QApplication app(argc, argv);
 
   // setup a splash screen
@@ -68,6 +341,10 @@ int main(int argc, char *argv[])
   dealii::ParameterGui::MainWindow * main_win =
     new dealii::ParameterGui::MainWindow (argv[1]);
 
+  // further PRM files are applied as layers on top of it
+  if (argc > 2)
+    main_win->add_layers(app.arguments().mid(2));
+
   // show the main window with a short delay
   // so we can see the splash screen
   QTimer::singleShot(1500, main_win, SLOT(show()));
@@ -15,10 +15,20 @@
 
 
 #include "mainwindow.h"
+#include "bulk_edit.h"
 #include "parameter_delegate.h"
+#include "parameter_item.h"
+#include "parameter_linter.h"
+#include "parameter_pattern.h"
+#include "parameter_value.h"
 #include "xml_parameter_reader.h"
 #include "xml_parameter_writer.h"
+#include "prm_parameter_reader.h"
 #include "prm_parameter_writer.h"
+#include "xml_to_prm_converter.h"
+#include "string_pool.h"
+#include "go_to_dialog.h"
+#include "analytics_dialog.h"
 
 #include <QtGlobal>
 #if QT_VERSION >= 0x050000
@@ -32,6 +42,8 @@ namespace dealii
   namespace ParameterGui
   {
     MainWindow::MainWindow(const QString  &filename)
+                        : search_index_builder(0),
+                          current_search_result(-1)
     {
       // load settings
       gui_settings = new QSettings ("deal.II", "parameterGUI");
@@ -40,17 +52,40 @@ namespace dealii
       tree_widget = new QTreeWidget;
 
       // Setup the tree and the window first:
+      // We do not let the header resize the columns to their contents, since this
+      // measures the rows of the whole tree after every change. Instead, we resize
+      // the columns to the rows in the visible area whenever they change.
 #if QT_VERSION >= 0x050000
-      tree_widget->header()->setSectionResizeMode(QHeaderView::ResizeToContents);
+      tree_widget->header()->setSectionResizeMode(QHeaderView::Interactive);
 #else
-      tree_widget->header()->setResizeMode(QHeaderView::ResizeToContents);
+      tree_widget->header()->setResizeMode(QHeaderView::Interactive);
 #endif
       tree_widget->setHeaderLabels(QStringList() << tr("(Sub)Sections/Parameters")
                                                  << tr("Value"));
 
+      column_widths_reset = true;
+      tree_matches_file = false;
+      column_resize_timer = new QTimer(this);
+      column_resize_timer->setSingleShot(true);
+      column_resize_timer->setInterval(100);
+      connect(column_resize_timer, SIGNAL(timeout()), this, SLOT(resize_columns()));
+
+      path_checker = new PathChecker(10000, this);
+      connect(path_checker, SIGNAL(checked(const QStringList &)), this, SLOT(paths_checked(const QStringList &)));
+
+      journal_timer = new QTimer(this);
+      journal_timer->setSingleShot(true);
+      journal_timer->setInterval(1000);
+      connect(journal_timer, SIGNAL(timeout()), this, SLOT(flush_journal()));
+
+      connect(tree_widget->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(schedule_column_resize()));
+      connect(tree_widget, SIGNAL(itemExpanded(QTreeWidgetItem *)), this, SLOT(schedule_column_resize()));
+      connect(tree_widget, SIGNAL(itemCollapsed(QTreeWidgetItem *)), this, SLOT(schedule_column_resize()));
+
       // enables mouse events e.g. showing ToolTips
       // and documentation in the StatusLine
       tree_widget->setMouseTracking(true);
+      tree_widget->setSelectionMode(QAbstractItemView::ExtendedSelection);
       tree_widget->setEditTriggers(QAbstractItemView::DoubleClicked|
                                    QAbstractItemView::SelectedClicked|
                                    QAbstractItemView::EditKeyPressed);
@@ -62,112 +97,1164 @@ namespace dealii
       // set the delegate for editing items
       tree_widget->setItemDelegate(new ParameterDelegate(1));
 
-      setCentralWidget(tree_widget);
+      setCentralWidget(tree_widget);
+
+      connect(tree_widget, SIGNAL(currentItemChanged(QTreeWidgetItem *, QTreeWidgetItem *)), this, SLOT(set_documentation_text(QTreeWidgetItem *, QTreeWidgetItem *)));
+      // connect: if the tree changes, the window will know
+      connect(tree_widget, SIGNAL(itemChanged(QTreeWidgetItem *, int)), this, SLOT(item_changed(QTreeWidgetItem *, int)));
+      connect(tree_widget, SIGNAL(itemChanged(QTreeWidgetItem*, int)), this, SLOT(tree_was_modified()));
+
+      QDockWidget *documentation_widget = new QDockWidget(tr("Parameter documentation:"), this);
+      documentation_text_widget = new QTextEdit(QString (""), documentation_widget);
+      documentation_text_widget->setReadOnly(true);
+
+      documentation_widget->setAllowedAreas(Qt::AllDockWidgetAreas);
+      documentation_widget->setWidget(documentation_text_widget);
+
+      addDockWidget(Qt::BottomDockWidgetArea, documentation_widget);
+
+      // create window actions as "Open",...
+      create_actions();
+      // and menus
+      create_menus();
+      // and the toolbar
+      create_toolbar();
+
+      statusBar()->showMessage(tr("Ready, start editing by double-clicking or hitting F2!"));
+      setWindowTitle(tr("[*]parameterGUI"));
+
+      gui_settings->beginGroup("MainWindow");
+      resize(gui_settings->value("size", QSize(800, 600)).toSize());
+      move(gui_settings->value("pos", QPoint(0, 0)).toPoint());
+      gui_settings->endGroup();
+
+      // if there is a file_name, try to load the file.
+      // a valid file has the xml extension, so we require size() > 3
+      if (filename.size() > 3)
+        load_file(filename);
+
+      apply_settings();
+    }
+
+
+
+    MainWindow::~MainWindow()
+    {
+      if (search_index_builder)
+        search_index_builder->wait();
+
+      // the schema stays in the pool while other windows use it
+      tree_widget->clear();
+      StringPool::release_unused();
+    }
+
+
+
+    void MainWindow::set_documentation_text(QTreeWidgetItem *selected_item,
+                                            QTreeWidgetItem *previous_item)
+    {
+      documentation_text_widget->clear();
+      documentation_text_widget->insertPlainText(selected_item->text(3));
+
+      if (selected_item->data(1, ParameterItem::missing_path_role).toBool())
+        documentation_text_widget->insertPlainText("\n\n" + tr("A file or directory named by the value does not exist."));
+    }
+
+
+
+    void MainWindow::item_changed(QTreeWidgetItem *item,
+                                  int column)
+    {
+      if (column != 1)
+        return;
+
+      // the value may have been changed in an editor, bulk edits
+      // update the stored value themselves
+      ParameterItem::update_value(item);
+
+      // itemChanged is also emitted if e.g. the font of the item changes
+      if (!record_edit(item))
+        return;
+
+      edit_log.finish_step();
+      update_undo_actions();
+
+      // changes outside of the visible area do not affect the column widths
+      if (tree_widget->viewport()->rect().intersects(tree_widget->visualItemRect(item)))
+        schedule_column_resize();
+
+      update_item(item);
+    }
+
+
+
+    void MainWindow::update_item(QTreeWidgetItem *item)
+    {
+      if (ParameterItem::has_default_value(item))
+        {
+          QFont font = item->font(1);
+          font.setWeight(QFont::Normal);
+          item->setFont(1,font);
+        }
+      else
+        {
+          QFont font = item->font(1);
+          font.setWeight(QFont::Bold);
+          item->setFont(1,font);
+        }
+
+      // hide the item if it does not pass the filter anymore
+      if (!filter.accepts(item))
+        item->setHidden(true);
+
+      // keep the search index up to date
+      const int id = path_index.id(item);
+      if (id != -1)
+        {
+          if (search_index_builder)
+            values_edited_while_indexing.insert(id);
+          else
+            search_index.update_value(id, item->text(1));
+        }
+
+      // only the paths of the new value are checked
+      check_paths(item);
+    }
+
+
+
+    void MainWindow::check_paths(QTreeWidgetItem *item)
+    {
+      const int id = path_index.id(item);
+      if (id == -1)
+        return;
+
+      const QString pattern_description = item->data(1, ParameterItem::pattern_description_role).toString();
+      const ParameterPattern pattern = ParameterPattern::get(pattern_description);
+
+      // files written by the program do not need to exist, and relative
+      // paths are taken relative to the directory of the parameter file
+      QStringList paths;
+      if ((pattern.kind == ParameterPattern::file_name ||
+           pattern.kind == ParameterPattern::file_list ||
+           pattern.kind == ParameterPattern::directory_name) &&
+          !pattern_description.contains("Type: output"))
+        {
+          const QDir directory = QFileInfo(current_file).absoluteDir();
+          const QString value = item->data(1, Qt::EditRole).toString();
+          const QStringList names = (pattern.kind == ParameterPattern::file_list
+                                     ? value.split(pattern.list_separator)
+                                     : QStringList(value));
+
+          foreach (const QString &name, names)
+            if (!name.trimmed().isEmpty())
+              paths.append(QDir::cleanPath(directory.absoluteFilePath(name.trimmed())));
+        }
+
+      // forget the paths of the previous value
+      const QStringList previous_paths = checked_paths.value(id);
+      foreach (const QString &path, previous_paths)
+        {
+          QHash<QString, QSet<int> >::iterator ids = ids_by_checked_path.find(path);
+          if (ids != ids_by_checked_path.end())
+            {
+              ids.value().remove(id);
+              if (ids.value().isEmpty())
+                ids_by_checked_path.erase(ids);
+            }
+        }
+
+      if (paths.isEmpty())
+        checked_paths.remove(id);
+      else
+        {
+          checked_paths.insert(id, paths);
+          foreach (const QString &path, paths)
+            {
+              ids_by_checked_path[path].insert(id);
+              path_checker->check(path);
+            }
+        }
+
+      // show the cached results until the new ones are available
+      update_path_mark(id);
+    }
+
+
+
+    void MainWindow::update_path_mark(const int id)
+    {
+      QTreeWidgetItem * item = path_index.item(id);
+      if (!item)
+        return;
+
+      const bool directories =
+        (ParameterPattern::get(item->data(1, ParameterItem::pattern_description_role).toString()).kind
+         == ParameterPattern::directory_name);
+
+      bool missing = false;
+      foreach (const QString &path, checked_paths.value(id))
+        {
+          const PathChecker::State state = path_checker->state(path);
+
+          if (state == PathChecker::missing ||
+              (directories && state == PathChecker::file))
+            missing = true;
+        }
+
+      // the mark is not a change of the parameter
+      if (item->data(1, ParameterItem::missing_path_role).toBool() != missing)
+        {
+          const bool blocked = tree_widget->blockSignals(true);
+          item->setData(1, ParameterItem::missing_path_role, missing);
+          tree_widget->blockSignals(blocked);
+        }
+    }
+
+
+
+    void MainWindow::paths_checked(const QStringList &paths)
+    {
+      QSet<int> ids;
+      foreach (const QString &path, paths)
+        ids.unite(ids_by_checked_path.value(path));
+
+      foreach (int id, ids)
+        update_path_mark(id);
+    }
+
+
+
+    QList<QTreeWidgetItem *> MainWindow::selected_parameters() const
+    {
+      QList<QTreeWidgetItem *> items = tree_widget->selectedItems();
+
+      if (items.isEmpty() && tree_widget->currentItem())
+        items.append(tree_widget->currentItem());
+
+      return BulkEdit::parameters(items);
+    }
+
+
+
+    bool MainWindow::record_edit(QTreeWidgetItem *item)
+    {
+      const QVariant old_value = item->data(1,ParameterItem::committed_value_role);
+      const QVariant new_value = item->data(1,Qt::EditRole);
+
+      // the item is still being read
+      if (!old_value.isValid())
+        return true;
+
+      if (old_value == new_value)
+        return false;
+
+      const int id = path_index.id(item);
+      edit_log.record(id, old_value, new_value);
+      variants.record(id, old_value, new_value, ParameterItem::is_modified(item));
+      record_in_journal(id, new_value);
+
+      const bool signals_blocked = tree_widget->blockSignals(true);
+      item->setData(1, ParameterItem::committed_value_role, new_value);
+      tree_widget->blockSignals(signals_blocked);
+
+      return true;
+    }
+
+
+
+    void MainWindow::record_in_journal(const int       id,
+                                       const QVariant &value)
+    {
+      // only changes of the document are protected against crashes, not
+      // switching variants or applying layers, which are not saved
+      journal.record(path_index.path(id), value);
+      if (!journal_timer->isActive())
+        journal_timer->start();
+    }
+
+
+
+    void MainWindow::finish_bulk_edit(const QList<QTreeWidgetItem *> &changed_items,
+                                      const bool                      modified)
+    {
+      statusBar()->showMessage(tr("%n parameter(s) changed", "", changed_items.size()), 5000);
+
+      if (changed_items.isEmpty())
+        return;
+
+      tree_matches_file = false;
+
+      // updating the fonts would emit itemChanged again
+      const bool signals_blocked = tree_widget->blockSignals(true);
+      foreach (QTreeWidgetItem *item, changed_items)
+        {
+          record_edit(item);
+          update_item(item);
+        }
+      tree_widget->blockSignals(signals_blocked);
+
+      // all changes are undone at once
+      edit_log.finish_step();
+      update_undo_actions();
+
+      schedule_column_resize();
+
+      if (modified)
+        tree_was_modified();
+    }
+
+
+
+    void MainWindow::undo()
+    {
+      if (!edit_log.can_undo())
+        return;
+
+      apply_edits(edit_log.undo(), true);
+    }
+
+
+
+    void MainWindow::redo()
+    {
+      if (!edit_log.can_redo())
+        return;
+
+      apply_edits(edit_log.redo(), false);
+    }
+
+
+
+    void MainWindow::apply_edits(const QVector<EditLog::Edit> &edits,
+                                 const bool                    revert)
+    {
+      QList<QTreeWidgetItem *> changed_items;
+
+      {
+        BulkEdit edit(tree_widget);
+        foreach (const EditLog::Edit &e, edits)
+          if (QTreeWidgetItem * item = path_index.item(e.id))
+            {
+              const QVariant &value = (revert ? e.old_value : e.new_value);
+              const QVariant current = item->data(1,Qt::EditRole);
+              edit.set_data(item, value);
+
+              // the edit log already has this change, but the variant not
+              item->setData(1, ParameterItem::committed_value_role, value);
+              variants.record(e.id, current, value, ParameterItem::is_modified(item));
+              record_in_journal(e.id, value);
+            }
+        changed_items = edit.changed_items();
+      }
+
+      finish_bulk_edit(changed_items);
+    }
+
+
+
+    void MainWindow::select_variant(int index)
+    {
+      const QString name = variant_box->itemText(index);
+      if (name == variants.active())
+        return;
+
+      apply_variant(name);
+
+      // the changes in the edit log refer to the values of the previous variant
+      edit_log.clear();
+      update_undo_actions();
+    }
+
+
+
+    void MainWindow::new_variant()
+    {
+      bool ok = false;
+      const QString name = QInputDialog::getText(this, tr("New variant"),
+                                                 tr("Name of the new variant, a copy of \"%1\":")
+                                                 .arg(variants.active()),
+                                                 QLineEdit::Normal, QString(), &ok).trimmed();
+      if (!ok || name.isEmpty())
+        return;
+
+      if (variants.contains(name))
+        {
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("There already is a variant called %1.").arg(name));
+          return;
+        }
+
+      variants.add(name);
+      variants.switch_to(name);
+      update_variant_box();
+
+      edit_log.clear();
+      update_undo_actions();
+    }
+
+
+
+    void MainWindow::remove_variant()
+    {
+      const QStringList names = variants.names();
+      if (names.size() < 2)
+        return;
+
+      const QString name = variants.active();
+
+      if (QMessageBox::question(this, tr("parameterGUI"),
+                                      tr("Remove the variant %1?").arg(name),
+                                      QMessageBox::Yes | QMessageBox::No) != QMessageBox::Yes)
+        return;
+
+      apply_variant(names[names[0] == name ? 1 : 0]);
+      variants.remove(name);
+      update_variant_box();
+
+      edit_log.clear();
+      update_undo_actions();
+    }
+
+
+
+    void MainWindow::save_all_variants()
+    {
+      const QString filters = tr("XML Files (*.xml);;PRM Files (*.prm)");
+
+      // every variant is saved to the file name with the name of the variant appended
+      const QString file_name =
+        QFileDialog::getSaveFileName(this, tr("Save All Variants"),
+                                     QDir::currentPath() + QDir::separator() + current_file,
+                                     filters);
+      if (file_name.isEmpty())
+        return;
+
+      const QFileInfo info(file_name);
+      const QString active = variants.active();
+
+      foreach (const QString &name, variants.names())
+        {
+          // switching only to save is no change of the document
+          apply_variant(name, false);
+
+          const QString variant_file_name = info.path() + QDir::separator()
+                                            + info.completeBaseName() + "_" + name
+                                            + "." + info.suffix();
+          if (!write_file(variant_file_name))
+            break;
+        }
+
+      apply_variant(active, false);
+      statusBar()->showMessage(tr("Variants saved"), 2000);
+    }
+
+
+
+    void MainWindow::apply_variant(const QString &name,
+                                   const bool     modified)
+    {
+      const QHash<int, QVariant> values = variants.switch_to(name);
+      QList<QTreeWidgetItem *> changed_items;
+
+      {
+        BulkEdit edit(tree_widget);
+        for (QHash<int, QVariant>::const_iterator p = values.constBegin(); p != values.constEnd(); ++p)
+          if (QTreeWidgetItem * item = path_index.item(p.key()))
+            {
+              edit.set_data(item, p.value());
+
+              // switching is not a change that can be undone
+              item->setData(1, ParameterItem::committed_value_role, p.value());
+            }
+        changed_items = edit.changed_items();
+      }
+
+      update_variant_box();
+      finish_bulk_edit(changed_items, modified);
+    }
+
+
+
+    void MainWindow::update_variant_box()
+    {
+      const bool signals_blocked = variant_box->blockSignals(true);
+
+      variant_box->clear();
+      variant_box->addItems(variants.names());
+      variant_box->setCurrentIndex(variant_box->findText(variants.active()));
+
+      variant_box->blockSignals(signals_blocked);
+
+      remove_variant_act->setEnabled(variant_box->count() > 1);
+    }
+
+
+
+    void MainWindow::update_undo_actions()
+    {
+      undo_act->setEnabled(edit_log.can_undo());
+      redo_act->setEnabled(edit_log.can_redo());
+    }
+
+
+
+    void MainWindow::set_to_default()
+    {
+      const QList<QTreeWidgetItem *> items = selected_parameters();
+      QList<QTreeWidgetItem *> changed_items;
+
+      {
+        BulkEdit edit(tree_widget);
+        foreach (QTreeWidgetItem *item, items)
+          edit.set_to_default(item);
+        changed_items = edit.changed_items();
+      }
+
+      finish_bulk_edit(changed_items);
+    }
+
+
+
+    void MainWindow::scale_values()
+    {
+      const QList<QTreeWidgetItem *> items = selected_parameters();
+      if (items.isEmpty())
+        return;
+
+      bool ok = false;
+      const double factor = QInputDialog::getDouble(this, tr("Scale values"),
+                                                    tr("Multiply the selected numeric values by:"),
+                                                    1.0, -1e300, 1e300, 6, &ok);
+      if (!ok)
+        return;
+
+      QList<QTreeWidgetItem *> changed_items;
+
+      {
+        BulkEdit edit(tree_widget);
+        foreach (QTreeWidgetItem *item, items)
+          edit.scale(item, factor);
+        changed_items = edit.changed_items();
+      }
+
+      finish_bulk_edit(changed_items);
+    }
+
+
+
+    void MainWindow::set_values_by_path()
+    {
+      bool ok = false;
+      const QString path_pattern = QInputDialog::getText(this, tr("Set values by path"),
+                                                         tr("Path of the parameters, e.g. Solver/*/Tolerance:"),
+                                                         QLineEdit::Normal, QString(), &ok);
+      if (!ok || path_pattern.isEmpty())
+        return;
+
+      const QString value = QInputDialog::getText(this, tr("Set values by path"),
+                                                  tr("New value:"),
+                                                  QLineEdit::Normal, QString(), &ok);
+      if (!ok)
+        return;
+
+      const QRegExp rx(path_pattern, Qt::CaseSensitive, QRegExp::Wildcard);
+      QList<QTreeWidgetItem *> changed_items;
+      int skipped = 0;
+
+      {
+        BulkEdit edit(tree_widget);
+        for (int id = 0; id < path_index.size(); ++id)
+          {
+            QTreeWidgetItem * item = path_index.item(id);
+            if (item && item->childCount() == 0 && rx.exactMatch(path_index.path(id)))
+              edit.set_value(item, value);
+          }
+        changed_items = edit.changed_items();
+        skipped = edit.skipped_values();
+      }
+
+      finish_bulk_edit(changed_items);
+
+      if (skipped > 0)
+        QMessageBox::warning(this, tr("parameterGUI"),
+                                   tr("%n parameter(s) were not changed, since the value does not match their pattern.",
+                                      "", skipped));
+    }
+
+
+
+    void MainWindow::lint_files()
+    {
+      const QString directory =
+        QFileDialog::getExistingDirectory(this, tr("Directory of the parameter files"),
+                                          QDir::currentPath());
+      if (directory.isEmpty())
+        return;
+
+      const QStringList file_names = ParameterLinter::parameter_files(QStringList(directory));
+      if (file_names.isEmpty())
+        {
+          QMessageBox::information(this, tr("parameterGUI"),
+                                         tr("There are no parameter files in %1.").arg(directory));
+          return;
+        }
+
+      QApplication::setOverrideCursor(Qt::WaitCursor);
+
+      // the loaded file is the schema of the files
+      ParameterLinter linter;
+      if (tree_widget->topLevelItemCount() > 0)
+        {
+          QBuffer buffer;
+          buffer.open(QBuffer::ReadWrite);
+
+          XMLParameterWriter writer(tree_widget);
+          writer.write_xml_file(&buffer);
+          buffer.seek(0);
+
+          linter.set_schema(&buffer);
+        }
+
+      const QVector<ParameterLinter::FileReport> reports = linter.lint(file_names);
+
+      QApplication::restoreOverrideCursor();
+
+      // list the problems, but not too many of them
+      QStringList problems;
+      int files_with_problems = 0;
+
+      foreach (const ParameterLinter::FileReport &report, reports)
+        {
+          if (!report.error.isEmpty() || !report.issues.isEmpty())
+            ++files_with_problems;
+
+          if (!report.error.isEmpty() && problems.size() < 1000)
+            problems.append(tr("%1: %2").arg(report.file_name).arg(report.error));
+
+          foreach (const ParameterLinter::Issue &issue, report.issues)
+            if (problems.size() < 1000)
+              problems.append(tr("%1: %2 = %3: %4")
+                              .arg(report.file_name)
+                              .arg(issue.path)
+                              .arg(issue.value)
+                              .arg(issue.message));
+        }
+
+      QMessageBox message_box(files_with_problems == 0 ? QMessageBox::Information : QMessageBox::Warning,
+                              tr("parameterGUI"),
+                              tr("%1 of %n file(s) have problems.", "", reports.size())
+                              .arg(files_with_problems),
+                              QMessageBox::Save | QMessageBox::Close,
+                              this);
+      if (!problems.isEmpty())
+        message_box.setDetailedText(problems.join("\n"));
+
+      if (message_box.exec() != QMessageBox::Save)
+        return;
+
+      const QString report_name =
+        QFileDialog::getSaveFileName(this, tr("Save Report"),
+                                     QDir(directory).filePath("lint_report.xml"),
+                                     tr("XML Files (*.xml)"));
+      if (report_name.isEmpty())
+        return;
+
+      QFile report_file(report_name);
+      if (!report_file.open(QFile::WriteOnly | QFile::Text))
+        {
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("Cannot write file %1:\n%2.")
+                                     .arg(report_name)
+                                     .arg(report_file.errorString()));
+          return;
+        }
+
+      ParameterLinter::write_report(reports, &report_file);
+    }
+
+
+
+    void MainWindow::analyze_files()
+    {
+      const QString directory =
+        QFileDialog::getExistingDirectory(this, tr("Directory of the parameter files"),
+                                          QDir::currentPath());
+      if (directory.isEmpty())
+        return;
+
+      const QStringList file_names = ParameterLinter::parameter_files(QStringList(directory));
+      if (file_names.isEmpty())
+        {
+          QMessageBox::information(this, tr("parameterGUI"),
+                                         tr("There are no parameter files in %1.").arg(directory));
+          return;
+        }
+
+      QApplication::setOverrideCursor(Qt::WaitCursor);
+
+      ParameterTable table;
+      table.load(file_names);
+
+      QApplication::restoreOverrideCursor();
+
+      AnalyticsDialog dialog(&table, this);
+      dialog.exec();
+    }
+
+
+
+    void MainWindow::open()
+    {
+      // check, if the content was modified
+      if (maybe_save())
+        {
+          // open a file dialog
+          QString  file_name =
+                     QFileDialog::getOpenFileName(this, tr("Open XML Parameter File"),
+                                                  QDir::currentPath(),
+                                                  tr("XML Files (*.xml)"));
+
+          // if a file was selected, load the content
+          if (!file_name.isEmpty())
+            load_file(file_name);
+        }
+    }
+
+
+
+    void MainWindow::open_in_new_window()
+    {
+      QString  file_name =
+                 QFileDialog::getOpenFileName(this, tr("Open XML Parameter File"),
+                                              QDir::currentPath(),
+                                              tr("XML Files (*.xml)"));
+
+      if (file_name.isEmpty())
+        return;
+
+      // the new window shares the names, documentation and patterns of
+      // its parameters with all other windows through the StringPool
+      MainWindow * main_win = new MainWindow(file_name);
+      main_win->setAttribute(Qt::WA_DeleteOnClose);
+      main_win->show();
+    }
+
+
+
+    void MainWindow::flush_journal()
+    {
+      journal.flush();
+    }
+
+
+
+    void MainWindow::add_layers(const QStringList &file_names)
+    {
+      foreach (const QString &file_name, file_names)
+        {
+          QHash<int, QString> values, current_values;
+          if (!read_layer(file_name, values, current_values))
+            break;
+
+          layer_file_modified.append(QFileInfo(file_name).lastModified());
+          apply_layer_values(layers.push(file_name, values, current_values));
+        }
+
+      update_layer_actions();
+    }
+
+
+
+    void MainWindow::add_layer()
+    {
+      const QStringList file_names =
+        QFileDialog::getOpenFileNames(this, tr("Add Layers"),
+                                      QDir::currentPath(),
+                                      tr("PRM Files (*.prm)"));
+
+      if (!file_names.isEmpty())
+        add_layers(file_names);
+    }
+
+
+
+    void MainWindow::reload_layers()
+    {
+      for (int layer = 0; layer < layers.size(); ++layer)
+        {
+          const QString file_name = layers.name(layer);
+          const QDateTime modified = QFileInfo(file_name).lastModified();
+
+          if (modified == layer_file_modified[layer])
+            continue;
+
+          QHash<int, QString> values, current_values;
+          if (!read_layer(file_name, values, current_values))
+            continue;
+
+          layer_file_modified[layer] = modified;
+          apply_layer_values(layers.replace(layer, values, current_values));
+        }
+    }
+
+
+
+    void MainWindow::remove_top_layer()
+    {
+      if (layers.size() == 0)
+        return;
+
+      layer_file_modified.pop_back();
+      apply_layer_values(layers.pop());
+
+      update_layer_actions();
+    }
+
+
+
+    void MainWindow::save_top_layer()
+    {
+      if (layers.size() == 0)
+        return;
+
+      // the top layer consists of the parameters whose values differ
+      // from what the file and the layers below would give them
+      QSet<const QTreeWidgetItem *> items;
+      QHash<int, QString> values;
+      QHash<int, QString> current_values;
+
+      for (int id = 0; id < path_index.size(); ++id)
+        {
+          const QTreeWidgetItem * item = path_index.item(id);
+          if (!item || item->childCount() != 0)
+            continue;
+
+          const QVariant value = item->data(1, Qt::EditRole);
+          const ParameterPattern pattern
+            = ParameterPattern::get(item->data(1, ParameterItem::pattern_description_role).toString());
+          QString value_below;
+
+          const bool differs =
+            layers.value_below_top(id, value_below)
+            ? !ParameterValue::equal(value, value_below, pattern)
+            : ParameterItem::is_modified(item);
+
+          if (differs)
+            {
+              items.insert(item);
+              values.insert(id, value.toString());
+
+              // parameters the layers did not set so far get their value from
+              // the file back when they are no longer set, not the edited one
+              if (layers.layer_of(id) == -1)
+                current_values.insert(id, item->data(1, ParameterItem::original_value_role)
+                                          .value<ParameterValue>().to_string(pattern));
+            }
+        }
+
+      const QString file_name = layers.name(layers.size()-1);
+      QFile file(file_name);
+
+      if (!file.open(QFile::WriteOnly | QFile::Text))
+        {
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("Cannot write file %1:\n%2.")
+                                     .arg(file_name)
+                                     .arg(file.errorString()));
+          return;
+        }
+
+      PRMParameterWriter writer(tree_widget);
+      writer.write_prm_file(&file, items);
+      file.close();
+
+      // the values are those in the tree, so this only updates the layers shown
+      layer_file_modified.last() = QFileInfo(file_name).lastModified();
+      apply_layer_values(layers.replace(layers.size()-1, values, current_values));
+
+      statusBar()->showMessage(tr("Layer saved"), 2000);
+    }
+
+
+
+    bool MainWindow::read_layer(const QString        &file_name,
+                                QHash<int, QString>  &values,
+                                QHash<int, QString>  &current_values)
+    {
+      QFile file(file_name);
+
+      if (!file.open(QFile::ReadOnly | QFile::Text))
+        {
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("Cannot read file %1:\n%2.")
+                                     .arg(file_name)
+                                     .arg(file.errorString()));
+          return false;
+        }
+
+      PRMParameterReader reader;
+      if (!reader.read_prm_file(&file))
+        {
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("Parse error in file %1:\n%2")
+                                     .arg(file_name)
+                                     .arg(reader.error_string()));
+          return false;
+        }
+
+      // resolve the paths with one lookup each
+      const QHash<QString, QString> values_by_path = reader.values();
+      QStringList unknown_paths;
+
+      for (QHash<QString, QString>::const_iterator p = values_by_path.constBegin();
+           p != values_by_path.constEnd(); ++p)
+        {
+          const int id = path_index.id(p.key());
+          const QTreeWidgetItem * item = path_index.item(id);
+
+          if (!item || item->childCount() != 0)
+            {
+              unknown_paths.append(p.key());
+              continue;
+            }
+
+          values.insert(id, p.value());
+          current_values.insert(id, item->data(1, Qt::EditRole).toString());
+        }
+
+      if (!unknown_paths.isEmpty())
+        {
+          unknown_paths.sort();
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("%n parameter(s) in %1 do not exist and are ignored:\n%2", "",
+                                        unknown_paths.size())
+                                     .arg(file_name)
+                                     .arg(QStringList(unknown_paths.mid(0, 10)).join("\n")));
+        }
+
+      return true;
+    }
+
+
+
+    void MainWindow::apply_layer_values(const QHash<int, QString> &values)
+    {
+      QList<QTreeWidgetItem *> changed_items;
+
+      {
+        BulkEdit edit(tree_widget);
+        for (QHash<int, QString>::const_iterator p = values.constBegin(); p != values.constEnd(); ++p)
+          if (QTreeWidgetItem * item = path_index.item(p.key()))
+            {
+              edit.set_read_value(item, p.value());
+
+              // the values of the layers are not changes that can be undone
+              item->setData(1, ParameterItem::committed_value_role, item->data(1, Qt::EditRole));
+            }
+        changed_items = edit.changed_items();
+      }
+
+      finish_bulk_edit(changed_items, false);
+
+      // show which layer supplied the values, the tool tips are not a change
+      const bool blocked = tree_widget->blockSignals(true);
+      for (QHash<int, QString>::const_iterator p = values.constBegin(); p != values.constEnd(); ++p)
+        if (QTreeWidgetItem * item = path_index.item(p.key()))
+          {
+            const int layer = layers.layer_of(p.key());
+            item->setToolTip(0, layer == -1
+                                ? QString()
+                                : tr("Value from layer %1: %2")
+                                  .arg(layer+1)
+                                  .arg(QFileInfo(layers.name(layer)).fileName()));
+          }
+      tree_widget->blockSignals(blocked);
+    }
 
-      connect(tree_widget, SIGNAL(currentItemChanged(QTreeWidgetItem *, QTreeWidgetItem *)), this, SLOT(set_documentation_text(QTreeWidgetItem *, QTreeWidgetItem *)));
-      // connect: if the tree changes, the window will know
-      connect(tree_widget, SIGNAL(itemChanged(QTreeWidgetItem *, int)), this, SLOT(item_changed(QTreeWidgetItem *, int)));
-      connect(tree_widget, SIGNAL(itemChanged(QTreeWidgetItem*, int)), this, SLOT(tree_was_modified()));
 
-      QDockWidget *documentation_widget = new QDockWidget(tr("Parameter documentation:"), this);
-      documentation_text_widget = new QTextEdit(QString (""), documentation_widget);
-      documentation_text_widget->setReadOnly(true);
 
-      documentation_widget->setAllowedAreas(Qt::AllDockWidgetAreas);
-      documentation_widget->setWidget(documentation_text_widget);
+    void MainWindow::update_layer_actions()
+    {
+      reload_layers_act->setEnabled(layers.size() > 0);
+      remove_layer_act->setEnabled(layers.size() > 0);
+      save_top_layer_act->setEnabled(layers.size() > 0);
+    }
 
-      addDockWidget(Qt::BottomDockWidgetArea, documentation_widget);
 
-      // create window actions as "Open",...
-      create_actions();
-      // and menus
-      create_menus();
-      // and the toolbar
-      create_toolbar();
 
-      statusBar()->showMessage(tr("Ready, start editing by double-clicking or hitting F2!"));
-      setWindowTitle(tr("[*]parameterGUI"));
+    void MainWindow::set_sweep_values()
+    {
+      QTreeWidgetItem * item = tree_widget->currentItem();
+      if (!item || item->childCount() != 0)
+        return;
 
-      gui_settings->beginGroup("MainWindow");
-      resize(gui_settings->value("size", QSize(800, 600)).toSize());
-      move(gui_settings->value("pos", QPoint(0, 0)).toPoint());
-      gui_settings->endGroup();
+      const QString path = ParameterItem::path(item);
 
-      // if there is a file_name, try to load the file.
-      // a valid file has the xml extension, so we require size() > 3
-      if (filename.size() > 3)
-        load_file(filename);
+      bool ok = false;
+      const QString text = QInputDialog::getText(this, tr("Sweep values"),
+                                                 tr("Values of %1, separated by \";\",\n"
+                                                    "or a range first:step:last (empty to stop sweeping):").arg(path),
+                                                 QLineEdit::Normal, sweep.values(path).join("; "), &ok);
+      if (!ok)
+        return;
 
-      apply_settings();
-    }
+      const QStringList values = ParameterSweep::parse_values(text);
+      if (values.isEmpty() && !text.trimmed().isEmpty())
+        {
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("%1 is not a valid list or range of values.").arg(text));
+          return;
+        }
 
+      const ParameterPattern pattern =
+        ParameterPattern::get(item->data(1, ParameterItem::pattern_description_role).toString());
+
+      foreach (const QString &value, values)
+        if (!pattern.is_valid(value))
+          {
+            QMessageBox::warning(this, tr("parameterGUI"),
+                                       tr("The value %1 does not satisfy the pattern of %2.")
+                                       .arg(value)
+                                       .arg(path));
+            return;
+          }
 
+      sweep.set_values(path, values);
 
-    void MainWindow::set_documentation_text(QTreeWidgetItem *selected_item,
-                                            QTreeWidgetItem *previous_item)
-    {
-      documentation_text_widget->clear();
-      documentation_text_widget->insertPlainText(selected_item->text(3));
+      // the tool tip is not a change of the parameter
+      const bool blocked = tree_widget->blockSignals(true);
+      item->setToolTip(1, values.isEmpty() ? QString() : tr("Sweep: %1").arg(values.join("; ")));
+      tree_widget->blockSignals(blocked);
+
+      generate_sweep_act->setEnabled(!sweep.is_empty());
     }
 
 
 
-    void MainWindow::item_changed(QTreeWidgetItem *item,
-                                  int column)
+    void MainWindow::generate_sweep()
     {
-      if (column != 1)
+      if (sweep.is_empty())
         return;
 
-      bool has_default_value;
+      const int product_size = sweep.product_size();
+      const QString product_item = (product_size > ParameterSweep::max_combinations
+                                    ? tr("All combinations (more than %1)").arg(ParameterSweep::max_combinations)
+                                    : tr("All %1 combinations").arg(product_size));
+
+      bool ok = false;
+      const QString sampling = QInputDialog::getItem(this, tr("Generate sweep"),
+                                                     tr("Files to generate:"),
+                                                     QStringList() << product_item
+                                                                   << tr("Latin hypercube sample"),
+                                                     0, false, &ok);
+      if (!ok)
+        return;
 
-      if (item->text(5).startsWith("[Double"))
-        has_default_value = item->data(1,Qt::DisplayRole).toReal() == item->data(2,Qt::DisplayRole).toReal();
-      else
-        has_default_value = item->data(1,Qt::DisplayRole).toString() == item->data(2,Qt::DisplayRole).toString();
+      QVector<QVector<int> > combinations;
 
-      if (has_default_value)
+      if (sampling == product_item)
         {
-          QFont font = item->font(1);
-          font.setWeight(QFont::Normal);
-          item->setFont(1,font);
+          if (product_size > ParameterSweep::max_combinations)
+            {
+              QMessageBox::warning(this, tr("parameterGUI"),
+                                         tr("There are too many combinations, use a sample instead."));
+              return;
+            }
 
-          const bool hide_items_with_default_value = gui_settings->value("Settings/hideDefault", false).toBool();
-          if (hide_items_with_default_value)
-            item->setHidden(true);
+          combinations = sweep.cartesian_product();
         }
       else
         {
-          QFont font = item->font(1);
-          font.setWeight(QFont::Bold);
-          item->setFont(1,font);
+          const int samples = QInputDialog::getInt(this, tr("Generate sweep"),
+                                                   tr("Number of samples:"),
+                                                   qMin(100, product_size), 1,
+                                                   ParameterSweep::max_combinations, 1, &ok);
+          if (!ok)
+            return;
+
+          combinations = sweep.latin_hypercube(samples);
         }
-    }
 
+      const QString format = QInputDialog::getItem(this, tr("Generate sweep"),
+                                                   tr("Format of the files:"),
+                                                   QStringList() << "prm" << "xml",
+                                                   0, false, &ok);
+      if (!ok)
+        return;
 
+      const QString directory =
+        QFileDialog::getExistingDirectory(this, tr("Directory for the files"),
+                                          QDir::currentPath());
+      if (directory.isEmpty())
+        return;
 
-    void MainWindow::set_to_default()
-    {
-      QTreeWidgetItem * current_item = tree_widget->currentItem();
-      current_item->setText(1,current_item->text(2));
+      const QString base_name = (current_file.isEmpty()
+                                 ? QString("parameters")
+                                 : QFileInfo(current_file).completeBaseName());
+
+      QApplication::setOverrideCursor(Qt::WaitCursor);
+
+      // the files are generated from the parameters as they are shown,
+      // which is the tree written in XML format
+      QBuffer buffer;
+      buffer.open(QBuffer::ReadWrite);
+
+      XMLParameterWriter writer(tree_widget);
+      writer.write_xml_file(&buffer);
+      buffer.seek(0);
+
+      const bool generated = sweep.generate(&buffer, combinations, directory, base_name,
+                                            format == "xml" ? ParameterSweep::xml : ParameterSweep::prm);
+
+      QApplication::restoreOverrideCursor();
+
+      if (!generated)
+        {
+          QMessageBox::warning(this, tr("parameterGUI"),
+                                     tr("Cannot generate the sweep:\n%1").arg(sweep.error_string()));
+          return;
+        }
+
+      statusBar()->showMessage(tr("%n file(s) written to %1", "", combinations.size()).arg(directory), 5000);
     }
 
 
 
-    void MainWindow::open()
+    void MainWindow::recover_journal(const QString &filename)
     {
-      // check, if the content was modified
-      if (maybe_save())
-        {
-          // open a file dialog
-          QString  file_name =
-                     QFileDialog::getOpenFileName(this, tr("Open XML Parameter File"),
-                                                  QDir::currentPath(),
-                                                  tr("XML Files (*.xml)"));
+      // the journal may belong to another window on the same file
+      if (!journal.is_open() || !EditJournal::exists(filename))
+        return;
 
-          // if a file was selected, load the content
-          if (!file_name.isEmpty())
-            load_file(file_name);
+      if (QMessageBox::question(this, tr("parameterGUI"),
+                                      tr("There are unsaved changes of %1 from a previous session.\n"
+                                         "Do you want to recover them?").arg(filename),
+                                      QMessageBox::Yes | QMessageBox::No) != QMessageBox::Yes)
+        {
+          journal.remove();
+          return;
         }
+
+      const QVector<EditJournal::Entry> entries = EditJournal::read(filename);
+
+      // the recovered changes are recorded in a new journal
+      journal.remove();
+
+      QList<QTreeWidgetItem *> changed_items;
+
+      {
+        BulkEdit edit(tree_widget);
+        foreach (const EditJournal::Entry &entry, entries)
+          {
+            QTreeWidgetItem * item = path_index.item(entry.path);
+            if (item && item->childCount() == 0)
+              edit.set_data(item, entry.value);
+          }
+        changed_items = edit.changed_items();
+      }
+
+      finish_bulk_edit(changed_items);
     }
 
 
@@ -283,6 +1370,7 @@ namespace dealii
       // and we use the windowModified mechanism to show a "*"
       // in the window title, if content was modified
       setWindowModified(true);
+      tree_matches_file = false;
     }
 
 
@@ -316,6 +1404,7 @@ namespace dealii
     {
       update_visible_items();
       update_font();
+      update_view_mode();
     }
 
 
@@ -333,51 +1422,155 @@ namespace dealii
     {
       const bool hide_default_values = gui_settings->value("Settings/hideDefault", false).toBool();
 
-      if (hide_default_values)
-        {
-        for (int i = 0; i < tree_widget->topLevelItemCount(); ++i)
-            hide_item_with_default_value(tree_widget->topLevelItem(i));
-        hide_default->setChecked(true);
-        }
-      else
-        {
-          QTreeWidgetItemIterator it(tree_widget,QTreeWidgetItemIterator::Hidden);
-          while (*it)
-            {
-              (*it)->setHidden(false);
-              ++it;
-            }
-          hide_default->setChecked(false);
-          }
+      filter.set_option(ParameterFilter::hide_defaults, hide_default_values);
+      filter.apply(tree_widget);
+
+      hide_default->setChecked(hide_default_values);
+    }
+
+
+
+    void MainWindow::show_only_modified(const bool enabled)
+    {
+      filter.set_option(ParameterFilter::only_modified, enabled);
+      filter.apply(tree_widget);
+    }
+
+
+
+    void MainWindow::show_only_invalid(const bool enabled)
+    {
+      filter.set_option(ParameterFilter::only_invalid, enabled);
+      filter.apply(tree_widget);
+    }
+
+
+
+    void MainWindow::set_filter_text(const QString &text)
+    {
+      filter.set_text(text);
+      filter.apply(tree_widget);
     }
 
 
 
-    bool MainWindow::hide_item_with_default_value(QTreeWidgetItem *item)
+    void MainWindow::search(const QString &text)
     {
-      bool has_default_value = true;
+      search_results.clear();
+      current_search_result = -1;
+
+      if (text.isEmpty())
+        return;
 
-      if (item->childCount() == 0)
+      if (search_index_builder)
         {
-          if (item->text(5).startsWith("[Double"))
-            has_default_value = item->data(1,Qt::DisplayRole).toReal() == item->data(2,Qt::DisplayRole).toReal();
-          else
-            has_default_value = item->data(1,Qt::DisplayRole).toString() == item->data(2,Qt::DisplayRole).toString();
+          statusBar()->showMessage(tr("The search index is being built, please wait a moment."), 2000);
+          return;
         }
+
+      // more results can not be stepped through in any reasonable time
+      const int max_search_results = 1000;
+      search_results = search_index.search(text, max_search_results);
+
+      if (search_results.isEmpty())
+        statusBar()->showMessage(tr("No matching parameters"), 2000);
       else
+        show_next_search_result();
+    }
+
+
+
+    void MainWindow::show_next_search_result()
+    {
+      if (search_results.isEmpty())
+        return;
+
+      current_search_result = (current_search_result + 1) % search_results.size();
+
+      show_item(path_index.item(search_results[current_search_result]));
+
+      statusBar()->showMessage(tr("Match %1 of %2, press Enter for the next match")
+                               .arg(current_search_result + 1)
+                               .arg(search_results.size()), 5000);
+    }
+
+
+
+    void MainWindow::show_item(QTreeWidgetItem *item)
+    {
+      for (QTreeWidgetItem *parent = item->parent(); parent != 0; parent = parent->parent())
+        parent->setExpanded(true);
+
+      tree_widget->setCurrentItem(item);
+      tree_widget->scrollToItem(item);
+    }
+
+
+
+    void MainWindow::go_to_parameter()
+    {
+      GoToDialog dialog(&path_index, this);
+
+      if (dialog.exec() == QDialog::Accepted && dialog.selected_id() != -1)
+        show_item(path_index.item(dialog.selected_id()));
+    }
+
+
+
+    void MainWindow::build_search_index()
+    {
+      // an index for the previous file may still be built
+      if (search_index_builder)
         {
-          // If this element has children recurse into them and check for default values
-          for (int i = 0; i < item->childCount(); ++i)
-            {
-              const bool child_has_default_value = hide_item_with_default_value(item->child(i));
-              has_default_value = has_default_value & child_has_default_value;
-            }
+          // its finished() signal may already be queued, it must not
+          // be taken for the one of the builder started below
+          disconnect(search_index_builder, 0, this, 0);
+          search_index_builder->wait();
+          delete search_index_builder;
+          search_index_builder = 0;
         }
 
-      if (has_default_value)
-        item->setHidden(true);
+      search_index = ParameterSearchIndex();
+      values_edited_while_indexing.clear();
+      search_results.clear();
+
+      // copying the texts is cheap, they are implicitly shared with the items
+      QVector<ParameterSearchIndex::Entry> entries(path_index.size());
+
+      for (int id = 0; id < path_index.size(); ++id)
+        if (const QTreeWidgetItem * item = path_index.item(id))
+          {
+            entries[id].path = path_index.path(id);
+            entries[id].value = item->text(1);
+            entries[id].documentation = item->text(3);
+          }
+
+      search_index_builder = new SearchIndexBuilder(entries, this);
+      connect(search_index_builder, SIGNAL(finished()), this, SLOT(search_index_built()));
+      search_index_builder->start(QThread::LowPriority);
+    }
+
+
+
+    void MainWindow::search_index_built()
+    {
+      // the signal of a builder that was replaced by build_search_index()
+      // may still be delivered, only the current one has a result to take
+      if (!search_index_builder || sender() != search_index_builder)
+        return;
+
+      search_index = search_index_builder->index;
+
+      search_index_builder->deleteLater();
+      search_index_builder = 0;
 
-      return has_default_value;
+      // values edited in the meantime were indexed with their old value
+      foreach (const int id, values_edited_while_indexing)
+        search_index.update_value(id, path_index.item(id)->text(1));
+      values_edited_while_indexing.clear();
+
+      if (!search_edit->text().isEmpty())
+        search(search_edit->text());
     }
 
 
@@ -389,6 +1582,9 @@ namespace dealii
       // If not, or the content was saved, accept the event, otherwise ignore it
       if (maybe_save())
         {
+          // the changes were saved or discarded
+          journal.remove();
+
           gui_settings->beginGroup("MainWindow");
           gui_settings->setValue("size", size());
           gui_settings->setValue("pos", pos());
@@ -414,6 +1610,11 @@ namespace dealii
       open_act->setStatusTip(tr("Open a XML file"));
       connect(open_act, SIGNAL(triggered()), this, SLOT(open()));
 
+      open_in_new_window_act = new QAction(tr("Open in new &window..."), this);
+      open_in_new_window_act->setShortcut(Qt::CTRL + Qt::SHIFT + Qt::Key_O);
+      open_in_new_window_act->setStatusTip(tr("Open a XML file in a new window"));
+      connect(open_in_new_window_act, SIGNAL(triggered()), this, SLOT(open_in_new_window()));
+
       save_act = new QAction(tr("&Save ..."), this);
       save_act->setIcon(style->standardPixmap(QStyle::SP_DialogSaveButton));
       save_act->setShortcut(Qt::CTRL + Qt::Key_S);
@@ -445,9 +1646,86 @@ namespace dealii
       settings_act->setStatusTip(tr("Show the Settings Dialog"));
       connect(settings_act, SIGNAL(triggered()), this, SLOT(show_settings()));
 
+      undo_act = new QAction(tr("&Undo"), this);
+      undo_act->setShortcuts(QKeySequence::Undo);
+      undo_act->setStatusTip(tr("Undo the last change"));
+      undo_act->setEnabled(false);
+      connect(undo_act, SIGNAL(triggered()), this, SLOT(undo()));
+
+      redo_act = new QAction(tr("&Redo"), this);
+      redo_act->setShortcuts(QKeySequence::Redo);
+      redo_act->setStatusTip(tr("Redo the last undone change"));
+      redo_act->setEnabled(false);
+      connect(redo_act, SIGNAL(triggered()), this, SLOT(redo()));
+
+      new_variant_act = new QAction(tr("&New variant..."), this);
+      new_variant_act->setStatusTip(tr("Create a new variant as a copy of the current one"));
+      connect(new_variant_act, SIGNAL(triggered()), this, SLOT(new_variant()));
+
+      remove_variant_act = new QAction(tr("&Remove variant"), this);
+      remove_variant_act->setStatusTip(tr("Remove the current variant"));
+      remove_variant_act->setEnabled(false);
+      connect(remove_variant_act, SIGNAL(triggered()), this, SLOT(remove_variant()));
+
+      save_all_variants_act = new QAction(tr("&Save all variants..."), this);
+      save_all_variants_act->setStatusTip(tr("Save every variant to its own file"));
+      connect(save_all_variants_act, SIGNAL(triggered()), this, SLOT(save_all_variants()));
+
+      go_to_act = new QAction(tr("&Go to parameter..."), this);
+      go_to_act->setShortcut(Qt::CTRL + Qt::Key_P);
+      go_to_act->setStatusTip(tr("Jump to a parameter by its path"));
+      connect(go_to_act, SIGNAL(triggered()), this, SLOT(go_to_parameter()));
+
       set_to_default_act = new QAction("Set to default",context_menu);
+      set_to_default_act->setStatusTip(tr("Set the selected parameters and subsections to their default values"));
       tree_widget->addAction(set_to_default_act);
       connect(set_to_default_act, SIGNAL(triggered()), this, SLOT(set_to_default()));
+
+      scale_values_act = new QAction(tr("Scale values..."),context_menu);
+      scale_values_act->setStatusTip(tr("Multiply the selected numeric values by a factor"));
+      tree_widget->addAction(scale_values_act);
+      connect(scale_values_act, SIGNAL(triggered()), this, SLOT(scale_values()));
+
+      add_layer_act = new QAction(tr("&Add layers..."), this);
+      add_layer_act->setStatusTip(tr("Apply PRM files on top of the loaded file"));
+      connect(add_layer_act, SIGNAL(triggered()), this, SLOT(add_layer()));
+
+      reload_layers_act = new QAction(tr("Re&load layers"), this);
+      reload_layers_act->setStatusTip(tr("Read the layers whose files were changed again"));
+      reload_layers_act->setEnabled(false);
+      connect(reload_layers_act, SIGNAL(triggered()), this, SLOT(reload_layers()));
+
+      remove_layer_act = new QAction(tr("&Remove top layer"), this);
+      remove_layer_act->setStatusTip(tr("Remove the top layer and restore the values below it"));
+      remove_layer_act->setEnabled(false);
+      connect(remove_layer_act, SIGNAL(triggered()), this, SLOT(remove_top_layer()));
+
+      save_top_layer_act = new QAction(tr("&Save top layer"), this);
+      save_top_layer_act->setStatusTip(tr("Write the values that differ from the layers below to the file of the top layer"));
+      save_top_layer_act->setEnabled(false);
+      connect(save_top_layer_act, SIGNAL(triggered()), this, SLOT(save_top_layer()));
+
+      sweep_values_act = new QAction(tr("Sweep values..."),context_menu);
+      sweep_values_act->setStatusTip(tr("Choose the values the current parameter takes in a parameter study"));
+      tree_widget->addAction(sweep_values_act);
+      connect(sweep_values_act, SIGNAL(triggered()), this, SLOT(set_sweep_values()));
+
+      generate_sweep_act = new QAction(tr("&Generate sweep..."), this);
+      generate_sweep_act->setStatusTip(tr("Write a parameter file for every combination of the swept values"));
+      generate_sweep_act->setEnabled(false);
+      connect(generate_sweep_act, SIGNAL(triggered()), this, SLOT(generate_sweep()));
+
+      lint_files_act = new QAction(tr("&Lint files..."), this);
+      lint_files_act->setStatusTip(tr("Check all parameter files in a directory against the loaded file"));
+      connect(lint_files_act, SIGNAL(triggered()), this, SLOT(lint_files()));
+
+      analyze_files_act = new QAction(tr("&Analyze files..."), this);
+      analyze_files_act->setStatusTip(tr("Show which parameters differ between the parameter files in a directory"));
+      connect(analyze_files_act, SIGNAL(triggered()), this, SLOT(analyze_files()));
+
+      set_values_by_path_act = new QAction(tr("Set values by path..."), this);
+      set_values_by_path_act->setStatusTip(tr("Set all parameters whose paths match a pattern to one value"));
+      connect(set_values_by_path_act, SIGNAL(triggered()), this, SLOT(set_values_by_path()));
     }
 
 
@@ -457,6 +1735,7 @@ namespace dealii
       // create a file menu, and add the entries
       file_menu = menuBar()->addMenu(tr("&File"));
       file_menu->addAction(open_act);
+      file_menu->addAction(open_in_new_window_act);
       file_menu->addAction(save_act);
       file_menu->addAction(save_as_act);
       file_menu->addSeparator();
@@ -464,6 +1743,40 @@ namespace dealii
       file_menu->addSeparator();
       file_menu->addAction(exit_act);
 
+      // create an edit menu
+      edit_menu = menuBar()->addMenu(tr("&Edit"));
+      edit_menu->addAction(undo_act);
+      edit_menu->addAction(redo_act);
+      edit_menu->addSeparator();
+      edit_menu->addAction(go_to_act);
+      edit_menu->addSeparator();
+      edit_menu->addAction(set_to_default_act);
+      edit_menu->addAction(scale_values_act);
+      edit_menu->addAction(set_values_by_path_act);
+
+      // create a menu for the variants of the file
+      variants_menu = menuBar()->addMenu(tr("&Variants"));
+      variants_menu->addAction(new_variant_act);
+      variants_menu->addAction(remove_variant_act);
+      variants_menu->addSeparator();
+      variants_menu->addAction(save_all_variants_act);
+
+      // create a menu for the layers on top of the file
+      layers_menu = menuBar()->addMenu(tr("&Layers"));
+      layers_menu->addAction(add_layer_act);
+      layers_menu->addAction(reload_layers_act);
+      layers_menu->addAction(remove_layer_act);
+      layers_menu->addSeparator();
+      layers_menu->addAction(save_top_layer_act);
+
+      // create a menu for tools working on the whole file
+      tools_menu = menuBar()->addMenu(tr("&Tools"));
+      tools_menu->addAction(sweep_values_act);
+      tools_menu->addAction(generate_sweep_act);
+      tools_menu->addSeparator();
+      tools_menu->addAction(lint_files_act);
+      tools_menu->addAction(analyze_files_act);
+
       menuBar()->addSeparator();
 
       // create a help menu
@@ -485,12 +1798,46 @@ namespace dealii
 
       toolbar->addSeparator();
 
+      variant_box = new QComboBox(toolbar);
+      variant_box->setToolTip(tr("The current variant of the parameter file"));
+      variant_box->setSizeAdjustPolicy(QComboBox::AdjustToContents);
+      connect(variant_box, SIGNAL(activated(int)), this, SLOT(select_variant(int)));
+      toolbar->addWidget(variant_box);
+
       hide_default = new QToolButton(toolbar);
       hide_default->setText(tr("Hide default values"));
       hide_default->setCheckable(true);
       connect(hide_default, SIGNAL(clicked()), this, SLOT(toggle_visible_default_items()));
       QAction *hide_default_act = toolbar->addWidget(hide_default);
 
+      only_modified_act = new QAction(tr("Show only modified values"), this);
+      only_modified_act->setCheckable(true);
+      connect(only_modified_act, SIGNAL(toggled(bool)), this, SLOT(show_only_modified(bool)));
+
+      only_invalid_act = new QAction(tr("Show only invalid values"), this);
+      only_invalid_act->setCheckable(true);
+      connect(only_invalid_act, SIGNAL(toggled(bool)), this, SLOT(show_only_invalid(bool)));
+
+      filter_button = new QToolButton(toolbar);
+      filter_button->setText(tr("Filter"));
+      filter_button->setPopupMode(QToolButton::InstantPopup);
+      filter_button->addAction(only_modified_act);
+      filter_button->addAction(only_invalid_act);
+      toolbar->addWidget(filter_button);
+
+      filter_edit = new QLineEdit(toolbar);
+      filter_edit->setPlaceholderText(tr("Filter parameters"));
+      filter_edit->setMaximumWidth(200);
+      connect(filter_edit, SIGNAL(textChanged(const QString &)), this, SLOT(set_filter_text(const QString &)));
+      toolbar->addWidget(filter_edit);
+
+      search_edit = new QLineEdit(toolbar);
+      search_edit->setPlaceholderText(tr("Search names, values and documentation"));
+      search_edit->setMaximumWidth(300);
+      connect(search_edit, SIGNAL(textChanged(const QString &)), this, SLOT(search(const QString &)));
+      connect(search_edit, SIGNAL(returnPressed()), this, SLOT(show_next_search_result()));
+      toolbar->addWidget(search_edit);
+
       QToolButton *change_font = new QToolButton(toolbar);
       change_font->setText(tr("Change font"));
       connect(change_font, SIGNAL(clicked()), this, SLOT(select_font()));
@@ -524,6 +1871,24 @@ namespace dealii
 
 
     bool MainWindow::save_file(const QString &filename)
+    {
+      if (!write_file(filename))
+        return false;
+
+      // if we succeed, show a message and reset the window
+      statusBar()->showMessage(tr("File saved"), 2000);
+      set_current_file(filename);
+
+      // the file has all changes now
+      journal.remove();
+      journal.open(filename);
+
+      return true;
+    }
+
+
+
+    bool MainWindow::write_file(const QString &filename)
     {
       QFile  file(filename);
 
@@ -548,10 +1913,35 @@ namespace dealii
         }
       else if (filename.endsWith(".prm",Qt::CaseInsensitive))
         {
-          // create a prm writer and write the prm file
-          PRMParameterWriter writer(tree_widget);
-          if (!writer.write_prm_file(&file))
-            return false;
+          bool converted = false;
+
+          // if the tree is unchanged since the XML file was read or written,
+          // converting the file is faster than walking the tree
+          if (tree_matches_file &&
+              current_file.endsWith(".xml",Qt::CaseInsensitive) &&
+              QFileInfo(current_file).lastModified() == current_file_modified)
+            {
+              QFile source(current_file);
+              if (source.open(QFile::ReadOnly))
+                {
+                  XMLToPRMConverter converter;
+                  converted = converter.convert(&source, &file);
+                }
+
+              if (!converted)
+                {
+                  file.resize(0);
+                  file.seek(0);
+                }
+            }
+
+          // otherwise create a prm writer and write the prm file
+          if (!converted)
+            {
+              PRMParameterWriter writer(tree_widget);
+              if (!writer.write_prm_file(&file))
+                return false;
+            }
 
           gui_settings->setValue("Settings/DefaultSaveFormat", "prm");
         }
@@ -565,10 +1955,6 @@ namespace dealii
           return false;
         }
 
-      // if we succeed, show a message and reset the window
-      statusBar()->showMessage(tr("File saved"), 2000);
-      set_current_file(filename);
-
       return true;
     }
 
@@ -588,8 +1974,16 @@ namespace dealii
           return;
         };
 
+      // the changes of the previous file were saved or discarded
+      journal.remove();
+
       // clear the tree and read the xml file
+      tree_matches_file = false;
+      path_index.clear();
       tree_widget->clear();
+      StringPool::release_unused();
+      column_widths.clear();
+      column_widths_reset = true;
       XMLParameterReader xml_reader(tree_widget);
 
       if (!xml_reader.read_xml_file(&file))
@@ -608,6 +2002,35 @@ namespace dealii
           // show some informations how values can be edited
           show_message ();
         };
+
+      path_index.build(tree_widget);
+      build_search_index();
+
+      checked_paths.clear();
+      ids_by_checked_path.clear();
+      for (int id = 0; id < path_index.size(); ++id)
+        if (QTreeWidgetItem * item = path_index.item(id))
+          if (item->childCount() == 0)
+            check_paths(item);
+
+      edit_log.clear();
+      update_undo_actions();
+
+      variants.clear(tr("Default"));
+      update_variant_box();
+
+      sweep.clear();
+      generate_sweep_act->setEnabled(false);
+
+      layers.clear();
+      layer_file_modified.clear();
+      update_layer_actions();
+
+      journal.open(filename);
+      recover_journal(filename);
+
+      filter.apply(tree_widget);
+      schedule_column_resize();
     }
 
 
@@ -625,6 +2048,8 @@ namespace dealii
 
       // set the (global) current file to file_name
       current_file = filename;
+      current_file_modified = QFileInfo(filename).lastModified();
+      tree_matches_file = true;
 
       // and create the window title,
       std::string win_title = (filename.toStdString());
@@ -652,6 +2077,96 @@ namespace dealii
       QFont current_font;
       current_font.fromString(current_font_string);
       setFont(current_font);
+
+      // the font may have changed, measure the columns again
+      column_widths.clear();
+      column_widths_reset = true;
+      schedule_column_resize();
+    }
+
+
+
+    void MainWindow::update_view_mode()
+    {
+      const bool large_file_mode = gui_settings->value("Settings/largeFileMode", false).toBool();
+
+      // the delegate returns the same height for all rows, so in the
+      // mode for large files the view can skip asking every row for it
+      tree_widget->setUniformRowHeights(large_file_mode);
+    }
+
+
+
+    void MainWindow::schedule_column_resize()
+    {
+      column_resize_timer->start();
+    }
+
+
+
+    void MainWindow::resize_columns()
+    {
+      // the last column is stretched to the width of the view anyway
+      const int n_columns = tree_widget->columnCount() - 1;
+      column_widths.resize(n_columns);
+
+      const int viewport_height = tree_widget->viewport()->height();
+
+      // walk over the rows in the visible area only
+      QTreeWidgetItem *item = tree_widget->itemAt(QPoint(0, 0));
+
+      // without rows there is nothing to measure the columns by
+      if (!item)
+        return;
+
+      while (item && tree_widget->visualItemRect(item).top() < viewport_height)
+        {
+          for (int column = 0; column < n_columns; ++column)
+            column_widths[column] = qMax(column_widths[column], content_width(item, column));
+
+          item = tree_widget->itemBelow(item);
+        }
+
+      // after a new file or font was loaded the old widths do not matter,
+      // otherwise the columns only grow while scrolling and expanding
+      for (int column = 0; column < n_columns; ++column)
+        if (column_widths_reset || column_widths[column] > tree_widget->columnWidth(column))
+          tree_widget->setColumnWidth(column, column_widths[column]);
+      column_widths_reset = false;
+    }
+
+
+
+    int MainWindow::content_width(const QTreeWidgetItem *item,
+                                  const int              column) const
+    {
+      QStyle * style = tree_widget->style();
+
+      // this is the margin QItemDelegate draws around the text
+      const int text_margin = style->pixelMetric(QStyle::PM_FocusFrameHMargin, 0, tree_widget) + 1;
+
+      const QFontMetrics metrics(item->font(column).resolve(tree_widget->font()));
+      int width = metrics.width(item->text(column)) + 2 * text_margin;
+
+      if (!item->icon(column).isNull())
+        {
+          const int icon_width = (tree_widget->iconSize().isValid()
+                                  ? tree_widget->iconSize().width()
+                                  : style->pixelMetric(QStyle::PM_SmallIconSize, 0, tree_widget));
+          width += icon_width + 2 * text_margin;
+        }
+
+      // the first column is indented according to the depth of the item
+      if (column == 0)
+        {
+          int depth = (tree_widget->rootIsDecorated() ? 1 : 0);
+          for (const QTreeWidgetItem *parent = item->parent(); parent != 0; parent = parent->parent())
+            ++depth;
+
+          width += depth * tree_widget->indentation();
+        }
+
+      return width;
     }
 
 
@@ -667,7 +2182,7 @@ namespace dealii
                       &ok, current_font, this);
       if (ok) {
           gui_settings->setValue("Settings/Font", new_font.toString());
-          setFont(new_font);
+          update_font();
       }
     }
   }
@@ -21,11 +21,27 @@
 #include <QTreeWidget>
 #include <QDialog>
 #include <QSettings>
+#include <QDateTime>
 #include <QToolBar>
 #include <QToolButton>
+#include <QLineEdit>
+#include <QComboBox>
+#include <QTimer>
+#include <QVector>
+#include <QHash>
+#include <QSet>
 
 #include "info_message.h"
 #include "settings_dialog.h"
+#include "parameter_filter.h"
+#include "parameter_layers.h"
+#include "edit_journal.h"
+#include "edit_log.h"
+#include "parameter_path_index.h"
+#include "parameter_search_index.h"
+#include "parameter_sweep.h"
+#include "parameter_variants.h"
+#include "path_checker.h"
 
 
 namespace dealii
@@ -62,6 +78,17 @@ namespace dealii
        */
       MainWindow(const QString  &filename = "");
 
+      /**
+       * Destructor. Waits for a running search index build to finish.
+       */
+      ~MainWindow();
+
+      /**
+       * Apply the parameter files @p file_names in PRM format
+       * as layers on top of the loaded file, in the given order.
+       */
+      void add_layers(const QStringList &file_names);
+
     protected:
       /**
        * Reimplemented from QMainWindow.
@@ -76,6 +103,11 @@ namespace dealii
        */
       void open();
 
+      /**
+       * Open a parameter file in a new window.
+       */
+      void open_in_new_window();
+
       /**
        * Save the parameter file.
        */
@@ -106,11 +138,23 @@ namespace dealii
                                   QTreeWidgetItem *previous_item);
 
       /**
-       * A <tt>slot</tt> that is called when the active
-       * tree item should be set to its default value.
+       * A <tt>slot</tt> that is called when the selected
+       * parameters, or all parameters in the selected subsections,
+       * should be set to their default values.
        */
       void set_to_default();
 
+      /**
+       * Multiply the selected numeric parameters by a factor the user enters.
+       */
+      void scale_values();
+
+      /**
+       * Set all parameters whose paths match a wildcard pattern
+       * the user enters to one value.
+       */
+      void set_values_by_path();
+
       /**
        * A <tt>slot</tt> that is called when any
        * item value has changed. It updates the font depending
@@ -137,10 +181,32 @@ namespace dealii
       void update_visible_items();
 
       /**
-       * Reads the font from gui_settings and applies it.
+       * Reads the font from gui_settings and applies it. The
+       * widths of the columns are measured again afterwards.
        */
       void update_font();
 
+      /**
+       * Reads the view mode from gui_settings and applies it to tree_widget.
+       * In the mode for large files all rows have the same height, so that
+       * layout and scrolling do not depend on the number of parameters.
+       */
+      void update_view_mode();
+
+      /**
+       * Restart the timer after which the columns are resized. This <tt>slot</tt>
+       * is called whenever the visible rows change, e.g. after scrolling or
+       * expanding an item, so that a series of changes only resizes the columns once.
+       */
+      void schedule_column_resize();
+
+      /**
+       * Resize the columns of tree_widget to the contents of the rows in the visible area.
+       * Columns only grow, the widths are stored in column_widths, unless the
+       * widths were reset by column_widths_reset.
+       */
+      void resize_columns();
+
       /**
        * Changes whether default items should be displayed in the tree widget
        * and calls update_visible_items() to apply the changes.
@@ -152,6 +218,128 @@ namespace dealii
        * in gui_settings, and displays the new font.
        */
       void select_font();
+
+      /**
+       * Show only parameters that were modified since the file was loaded,
+       * if @p enabled is true.
+       */
+      void show_only_modified(const bool enabled);
+
+      /**
+       * Show only parameters whose values do not satisfy their patterns,
+       * if @p enabled is true.
+       */
+      void show_only_invalid(const bool enabled);
+
+      /**
+       * Show only parameters that contain @p text in their name or value.
+       */
+      void set_filter_text(const QString &text);
+
+      /**
+       * Search the parameters for @p text and show the first match.
+       */
+      void search(const QString &text);
+
+      /**
+       * Show the next parameter that matches the current search.
+       */
+      void show_next_search_result();
+
+      /**
+       * Undo the last step in edit_log.
+       */
+      void undo();
+
+      /**
+       * Redo the last step in edit_log that was undone.
+       */
+      void redo();
+
+      /**
+       * Make the variant at @p index in variant_box the current one.
+       */
+      void select_variant(int index);
+
+      /**
+       * Create a new variant as a copy of the current one.
+       */
+      void new_variant();
+
+      /**
+       * Remove the current variant.
+       */
+      void remove_variant();
+
+      /**
+       * Save every variant to a file of its own.
+       */
+      void save_all_variants();
+
+      /**
+       * Write the changes recorded in journal to the journal file.
+       */
+      void flush_journal();
+
+      /**
+       * Open a file dialog to add PRM files as layers on top of the loaded file.
+       */
+      void add_layer();
+
+      /**
+       * Read the layers whose files were changed again and update the
+       * parameters they affect.
+       */
+      void reload_layers();
+
+      /**
+       * Remove the top layer and restore the values it replaced.
+       */
+      void remove_top_layer();
+
+      /**
+       * Write the parameters that differ from the values given by the layers
+       * below the top layer to the file of the top layer.
+       */
+      void save_top_layer();
+
+      /**
+       * Ask the user for the values the current parameter should be swept over.
+       */
+      void set_sweep_values();
+
+      /**
+       * Write a file for every combination of the values of the swept parameters.
+       */
+      void generate_sweep();
+
+      /**
+       * Check all parameter files in a directory against the loaded file
+       * and show the problems found.
+       */
+      void lint_files();
+
+      /**
+       * Read all parameter files in a directory and show which parameters differ between them.
+       */
+      void analyze_files();
+
+      /**
+       * Mark the parameters that name the @p paths if these do not exist.
+       * This <tt>slot</tt> is called when path_checker has checked them.
+       */
+      void paths_checked(const QStringList &paths);
+
+      /**
+       * Open a dialog to jump to a parameter by its path.
+       */
+      void go_to_parameter();
+
+      /**
+       * A <tt>slot</tt> that is called when search_index_builder has finished.
+       * It takes over the new index.
+       */
+      void search_index_built();
     private:
       /**
        * Show an information dialog, how
@@ -188,28 +376,156 @@ namespace dealii
        */
       bool save_file (const QString &filename);
 
+      /**
+       * Offer to apply the changes in the journal of @p filename,
+       * which were not saved before the program ended.
+       */
+      void recover_journal (const QString &filename);
+
+      /**
+       * Write parameters to @p filename in XML or PRM format, depending on its extension.
+       */
+      bool write_file (const QString &filename);
+
       /**
        * Load parameters from @p filename in XML format.
        */
       void load_file (const QString &filename);
 
+      /**
+       * Update the font of @p item, whether it passes the filter
+       * and the search index after its value was changed.
+       */
+      void update_item(QTreeWidgetItem *item);
+
+      /**
+       * Let path_checker check whether the files and directories named
+       * by the value of @p item exist, if it is a &quot;FileName&quot;
+       * or &quot;DirectoryName&quot; parameter.
+       */
+      void check_paths(QTreeWidgetItem *item);
+
+      /**
+       * Mark the parameter @p id if one of the paths in its value is known not to exist.
+       */
+      void update_path_mark(const int id);
+
+      /**
+       * Return the selected parameters and the parameters in the selected
+       * subsections, or the current item if nothing is selected.
+       */
+      QList<QTreeWidgetItem *> selected_parameters() const;
+
+      /**
+       * Record the change of the value of @p item in edit_log. Returns false
+       * if the value did not change.
+       */
+      bool record_edit(QTreeWidgetItem *item);
+
+      /**
+       * Record the change of the parameter @p id to @p value in journal.
+       */
+      void record_in_journal(const int       id,
+                             const QVariant &value);
+
+      /**
+       * Update the parameters changed by a @ref BulkEdit, record them as one
+       * step in edit_log and mark the window as modified once, unless
+       * @p modified is false.
+       */
+      void finish_bulk_edit(const QList<QTreeWidgetItem *> &changed_items,
+                            const bool                      modified = true);
+
+      /**
+       * Set the parameters in @p edits to their old values if @p revert
+       * is true, or to their new values otherwise.
+       */
+      void apply_edits(const QVector<EditLog::Edit> &edits,
+                       const bool                    revert);
+
+      /**
+       * Enable the undo and redo actions if there is something to undo or redo.
+       */
+      void update_undo_actions();
+
+      /**
+       * Make @p name the current variant and update the parameters
+       * that differ from the previous one. The window is marked as
+       * modified unless @p modified is false.
+       */
+      void apply_variant(const QString &name,
+                         const bool     modified = true);
+
+      /**
+       * Fill variant_box with the names of the variants.
+       */
+      void update_variant_box();
+
+      /**
+       * Read the PRM file @p file_name and return the @p values it sets by parameter id
+       * and the @p current_values of these parameters. Returns false if the file can
+       * not be read.
+       */
+      bool read_layer(const QString        &file_name,
+                      QHash<int, QString>  &values,
+                      QHash<int, QString>  &current_values);
+
+      /**
+       * Set the parameters to @p values as resolved by layers and show
+       * which layer their values come from. Like switching variants, this
+       * is neither recorded in edit_log nor marks the window as modified.
+       */
+      void apply_layer_values(const QHash<int, QString> &values);
+
+      /**
+       * Enable the layer actions if there are layers.
+       */
+      void update_layer_actions();
+
+      /**
+       * Start building the search index for the parameters in tree_widget
+       * in a separate thread.
+       */
+      void build_search_index();
+
+      /**
+       * Expand the parents of @p item, make it the current item and scroll to it.
+       */
+      void show_item(QTreeWidgetItem *item);
+
       /**
        * This functions writes the current @p filename to the window title.
        */
       void set_current_file (const QString  &filename);
 
       /**
-       * Determine if the item and all of its children have the default value,
-       * and hide all default items. Returns true if the item and all of its
-       * children have default values.
+       * Return the width @p column of tree_widget needs to show the content of @p item.
        */
-      bool hide_item_with_default_value(QTreeWidgetItem *item);
+      int content_width(const QTreeWidgetItem *item,
+                        const int              column) const;
 
       /**
        * This is the tree structure in which we store all parameters.
        */
       QTreeWidget *tree_widget;
 
+      /**
+       * The timer that triggers resize_columns().
+       */
+      QTimer *column_resize_timer;
+
+      /**
+       * The widths of the columns of tree_widget as computed by resize_columns()
+       * since the last file was loaded.
+       */
+      QVector<int> column_widths;
+
+      /**
+       * Whether column_widths was cleared since the columns were last resized,
+       * so that the columns are set to the new widths even if they shrink.
+       */
+      bool column_widths_reset;
+
       /**
        * This is the documentation text area.
        */
@@ -221,12 +537,138 @@ namespace dealii
        */
       QToolButton *hide_default;
 
+      /**
+       * A tool button with a menu of further filter options.
+       */
+      QToolButton *filter_button;
+
+      /**
+       * A line editor for the filter text.
+       */
+      QLineEdit *filter_edit;
+
+      /**
+       * The filter that decides which items of tree_widget are shown.
+       */
+      ParameterFilter filter;
+
+      /**
+       * A line editor for searching parameters.
+       */
+      QLineEdit *search_edit;
+
+      /**
+       * The full-text index of the parameters in tree_widget.
+       */
+      ParameterSearchIndex search_index;
+
+      /**
+       * The thread that builds the next search_index, or 0 if no index is being built.
+       */
+      SearchIndexBuilder *search_index_builder;
+
+      /**
+       * The checker for the existence of the files and directories named by parameters.
+       */
+      PathChecker *path_checker;
+
+      /**
+       * The absolute paths named by the value of each parameter, by parameter id.
+       */
+      QHash<int, QStringList> checked_paths;
+
+      /**
+       * The ids of the parameters that name each path in checked_paths.
+       */
+      QHash<QString, QSet<int> > ids_by_checked_path;
+
+      /**
+       * The changes of parameter values that can be undone.
+       */
+      EditLog edit_log;
+
+      /**
+       * The journal of the changes of the current file since it was saved.
+       */
+      EditJournal journal;
+
+      /**
+       * The timer that triggers flush_journal().
+       */
+      QTimer *journal_timer;
+
+      /**
+       * The variants of the parameter file.
+       */
+      ParameterVariants variants;
+
+      /**
+       * The combo box to choose the current variant.
+       */
+      QComboBox *variant_box;
+
+      /**
+       * The layers of PRM files applied on top of the loaded file.
+       */
+      ParameterLayers layers;
+
+      /**
+       * The times the files of the layers were last modified when they were read.
+       */
+      QVector<QDateTime> layer_file_modified;
+
+      /**
+       * The parameters of a parameter study and their values.
+       */
+      ParameterSweep sweep;
+
+      /**
+       * The index of the paths of the items in tree_widget. Its ids
+       * are also used to identify the items in search_index.
+       */
+      ParameterPathIndex path_index;
+
+      /**
+       * The ids of parameters that were edited while search_index_builder was running.
+       */
+      QSet<int> values_edited_while_indexing;
+
+      /**
+       * The ids of the parameters matching the current search.
+       */
+      QVector<int> search_results;
+
+      /**
+       * The position of the parameter in search_results that is currently shown.
+       */
+      int current_search_result;
+
       /**
        * This menu provides all file actions as <tt>open</tt>, <tt>save</tt>, <tt>save as</tt>
        * and <tt>exit</tt>
        */
       QMenu *file_menu;
 
+      /**
+       * This menu provides actions for editing and navigating the parameters.
+       */
+      QMenu *edit_menu;
+
+      /**
+       * This menu provides actions for the variants of the parameter file.
+       */
+      QMenu *variants_menu;
+
+      /**
+       * This menu provides actions for the layers applied on top of the parameter file.
+       */
+      QMenu *layers_menu;
+
+      /**
+       * This menu provides tools that work on the whole parameter file.
+       */
+      QMenu *tools_menu;
+
       /**
        * This menu provides some informations <tt>about</tt> the parameterGUI
        * and <tt>about Qt</tt>
@@ -243,6 +685,11 @@ namespace dealii
        */
       QAction *open_act;
 
+      /**
+       * QAction <tt>open</tt> a file <tt>in a new window</tt>.
+       */
+      QAction *open_in_new_window_act;
+
       /**
        * QAction <tt>save</tt> a file.
        */
@@ -278,11 +725,113 @@ namespace dealii
        */
       QAction *set_to_default_act;
 
+      /**
+       * QAction <tt>scale values</tt>.
+       */
+      QAction *scale_values_act;
+
+      /**
+       * QAction <tt>set values by path</tt>.
+       */
+      QAction *set_values_by_path_act;
+
+      /**
+       * QAction <tt>undo</tt>.
+       */
+      QAction *undo_act;
+
+      /**
+       * QAction <tt>redo</tt>.
+       */
+      QAction *redo_act;
+
+      /**
+       * QAction <tt>new variant</tt>.
+       */
+      QAction *new_variant_act;
+
+      /**
+       * QAction <tt>remove variant</tt>.
+       */
+      QAction *remove_variant_act;
+
+      /**
+       * QAction <tt>save all variants</tt>.
+       */
+      QAction *save_all_variants_act;
+
+      /**
+       * QAction <tt>go to parameter</tt>.
+       */
+      QAction *go_to_act;
+
+      /**
+       * QAction <tt>add layer</tt>.
+       */
+      QAction *add_layer_act;
+
+      /**
+       * QAction <tt>reload layers</tt>.
+       */
+      QAction *reload_layers_act;
+
+      /**
+       * QAction <tt>remove top layer</tt>.
+       */
+      QAction *remove_layer_act;
+
+      /**
+       * QAction <tt>save top layer</tt>.
+       */
+      QAction *save_top_layer_act;
+
+      /**
+       * QAction <tt>sweep values</tt>.
+       */
+      QAction *sweep_values_act;
+
+      /**
+       * QAction <tt>generate sweep</tt>.
+       */
+      QAction *generate_sweep_act;
+
+      /**
+       * QAction <tt>lint files</tt>.
+       */
+      QAction *lint_files_act;
+
+      /**
+       * QAction <tt>analyze files</tt>.
+       */
+      QAction *analyze_files_act;
+
+      /**
+       * QAction <tt>show only modified values</tt>.
+       */
+      QAction *only_modified_act;
+
+      /**
+       * QAction <tt>show only invalid values</tt>.
+       */
+      QAction *only_invalid_act;
+
       /**
        * This value stores the current <tt>filename</tt> we work on.
        */
       QString  current_file;
 
+      /**
+       * The time <tt>current_file</tt> was last modified when we read or wrote it.
+       */
+      QDateTime  current_file_modified;
+
+      /**
+       * Whether the values in the tree are still those of <tt>current_file</tt>.
+       * Unlike the modified flag of the window, this is also cleared by
+       * switching variants and applying layers or recovered changes.
+       */
+      bool  tree_matches_file;
+
       /**
        * This dialog shows a short information message after loading a file.
        */
@@ -0,0 +1,151 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "multiple_selection_dialog.h"
+
+#include <QAbstractListModel>
+#include <QDialogButtonBox>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QVBoxLayout>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    /**
+     * The model of the list. The check state of every choice is a bit in <tt>selected</tt>.
+     */
+    class MultipleSelectionDialog::ChoiceModel : public QAbstractListModel
+    {
+    public:
+      ChoiceModel (const ParameterPattern &pattern,
+                   const QBitArray        &selected,
+                   QObject                *parent)
+        : QAbstractListModel(parent),
+          choices(pattern.choices),
+          selected(selected)
+      {
+        this->selected.resize(choices.size());
+      }
+
+      int rowCount (const QModelIndex &parent = QModelIndex()) const
+      {
+        return parent.isValid() ? 0 : choices.size();
+      }
+
+      QVariant data (const QModelIndex &index, int role) const
+      {
+        if (!index.isValid())
+          return QVariant();
+
+        if (role == Qt::DisplayRole)
+          return choices[index.row()];
+        else if (role == Qt::CheckStateRole)
+          return selected.testBit(index.row()) ? Qt::Checked : Qt::Unchecked;
+
+        return QVariant();
+      }
+
+      bool setData (const QModelIndex &index, const QVariant &value, int role)
+      {
+        if (!index.isValid() || role != Qt::CheckStateRole)
+          return false;
+
+        selected.setBit(index.row(), value.toInt() == Qt::Checked);
+
+        emit dataChanged(index, index);
+        return true;
+      }
+
+      Qt::ItemFlags flags (const QModelIndex &index) const
+      {
+        return QAbstractListModel::flags(index) | Qt::ItemIsUserCheckable;
+      }
+
+      void select_all (const bool value)
+      {
+        selected.fill(value);
+
+        if (!choices.isEmpty())
+          emit dataChanged(index(0), index(choices.size()-1));
+      }
+
+      const QStringList  choices;
+      QBitArray          selected;
+    };
+
+
+
+    MultipleSelectionDialog::MultipleSelectionDialog(const ParameterPattern &pattern,
+                                                     const QBitArray        &selected,
+                                                     QWidget                *parent)
+                           : QDialog(parent)
+    {
+      setWindowTitle(tr("Select Choices"));
+
+      choice_model = new ChoiceModel(pattern, selected, this);
+
+      choice_view = new QListView(this);
+      choice_view->setUniformItemSizes(true);
+      choice_view->setModel(choice_model);
+
+      QPushButton *all_button = new QPushButton(tr("&All"), this);
+      connect(all_button, SIGNAL(clicked()), this, SLOT(select_all()));
+
+      QPushButton *none_button = new QPushButton(tr("&None"), this);
+      connect(none_button, SIGNAL(clicked()), this, SLOT(select_none()));
+
+      QDialogButtonBox *button_box = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, Qt::Horizontal, this);
+      connect(button_box, SIGNAL(accepted()), this, SLOT(accept()));
+      connect(button_box, SIGNAL(rejected()), this, SLOT(reject()));
+
+      QHBoxLayout *buttons = new QHBoxLayout;
+      buttons->addWidget(all_button);
+      buttons->addWidget(none_button);
+      buttons->addStretch();
+      buttons->addWidget(button_box);
+
+      QVBoxLayout *layout = new QVBoxLayout;
+      layout->addWidget(choice_view);
+      layout->addLayout(buttons);
+      setLayout(layout);
+
+      resize(400, 500);
+    }
+
+
+
+    QBitArray MultipleSelectionDialog::selected() const
+    {
+      return choice_model->selected;
+    }
+
+
+
+    void MultipleSelectionDialog::select_all()
+    {
+      choice_model->select_all(true);
+    }
+
+
+
+    void MultipleSelectionDialog::select_none()
+    {
+      choice_model->select_all(false);
+    }
+  }
+}
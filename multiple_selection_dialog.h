@@ -0,0 +1,92 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef MULTIPLESELECTIONDIALOG_H
+#define MULTIPLESELECTIONDIALOG_H
+
+#include <QBitArray>
+#include <QDialog>
+#include <QListView>
+
+#include "parameter_pattern.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The MultipleSelectionDialog class shows the choices of a &quot;MultipleSelection&quot;
+     * parameter in a list with a check box for each choice. The selected choices are
+     * stored as a bit for each choice, so checking a choice, selecting all or none of
+     * them and reading the selection are operations on a QBitArray. The list only
+     * creates the rows that are shown, even if there are thousands of choices.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class MultipleSelectionDialog : public QDialog
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * Constructor. Shows the choices of @p pattern and checks those whose bits are set in @p selected.
+       */
+      MultipleSelectionDialog (const ParameterPattern &pattern,
+                               const QBitArray        &selected,
+                               QWidget                *parent = 0);
+
+      /**
+       * Return the bits of the checked choices.
+       */
+      QBitArray selected () const;
+
+    private slots:
+      /**
+       * Check all choices.
+       */
+      void select_all ();
+
+      /**
+       * Uncheck all choices.
+       */
+      void select_none ();
+
+    private:
+      class ChoiceModel;
+
+      /**
+       * The list of the choices.
+       */
+      QListView *choice_view;
+
+      /**
+       * The model of the list.
+       */
+      ChoiceModel *choice_model;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
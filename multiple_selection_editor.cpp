@@ -0,0 +1,128 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "multiple_selection_editor.h"
+#include "multiple_selection_dialog.h"
+
+#include <QHBoxLayout>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    MultipleSelectionEditor::MultipleSelectionEditor(QWidget *parent)
+                           : QFrame(parent, 0)
+    {
+      line_editor = new QLineEdit;
+      connect(line_editor, SIGNAL(editingFinished()), this, SLOT(editing_finished()));
+      connect(line_editor, SIGNAL(textChanged(const QString &)), this, SLOT(check_text(const QString &)));
+
+      choose_button = new QPushButton(tr("&Choose..."));
+      connect(choose_button, SIGNAL(clicked()), this, SLOT(choose()));
+
+      setFocusPolicy (Qt::StrongFocus);
+
+      QHBoxLayout *layout = new QHBoxLayout;
+
+      layout->setContentsMargins(1,1,1,1);
+      layout->addWidget(line_editor);
+      layout->addWidget(choose_button);
+      setLayout(layout);
+
+      setAutoFillBackground(true);
+      setBackgroundRole(QPalette::Highlight);
+    }
+
+
+
+    QSize MultipleSelectionEditor::sizeHint() const
+    {
+      QSize  size_line_editor   = line_editor->sizeHint(),
+             size_choose_button = choose_button->sizeHint();
+
+      int w = size_line_editor.rwidth() + size_choose_button.rwidth(),
+          h = qMax(size_line_editor.rheight(), size_choose_button.rheight());
+
+      return QSize (w, h);
+    }
+
+
+
+    QSize MultipleSelectionEditor::minimumSizeHint() const
+    {
+      QSize  size_line_editor   = line_editor->minimumSizeHint(),
+             size_choose_button = choose_button->minimumSizeHint();
+
+      int w = size_line_editor.rwidth() + size_choose_button.rwidth(),
+          h = qMax(size_line_editor.rheight(), size_choose_button.rheight());
+
+      return QSize (w, h);
+    }
+
+
+
+    void MultipleSelectionEditor::set_pattern(const ParameterPattern &new_pattern)
+    {
+      pattern = new_pattern;
+      check_text(line_editor->text());
+    }
+
+
+
+    QString MultipleSelectionEditor::text() const
+    {
+      return line_editor->text();
+    }
+
+
+
+    void MultipleSelectionEditor::setText(const QString &str)
+    {
+      line_editor->setText(str);
+    }
+
+
+
+    void MultipleSelectionEditor::editing_finished()
+    {
+      emit editingFinished();
+    }
+
+
+
+    void MultipleSelectionEditor::check_text(const QString &text)
+    {
+      QPalette palette = line_editor->palette();
+      palette.setColor(QPalette::Text, pattern.is_valid(text) ? QPalette().color(QPalette::Text) : QColor(Qt::red));
+      line_editor->setPalette(palette);
+    }
+
+
+
+    void MultipleSelectionEditor::choose()
+    {
+      // the dialog is a child of the editor, so the
+      // delegate does not close the editor when it opens
+      MultipleSelectionDialog dialog(pattern, pattern.selected_choices(line_editor->text()), this);
+
+      if (dialog.exec() == QDialog::Accepted)
+        {
+          line_editor->setText(pattern.selection_value(dialog.selected()));
+          emit editingFinished();
+        }
+    }
+  }
+}
@@ -0,0 +1,126 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef MULTIPLESELECTIONEDITOR_H
+#define MULTIPLESELECTIONEDITOR_H
+
+#include <QFrame>
+#include <QLineEdit>
+#include <QPushButton>
+
+#include "parameter_pattern.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The MultipleSelectionEditor class provides the editor for &quot;MultipleSelection&quot;
+     * parameters. The choices can be typed into its line editor, separated by commas, or
+     * checked in a @ref MultipleSelectionDialog, which the button opens. Choices typed
+     * into the line editor that are not choices of the pattern are shown in red.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class MultipleSelectionEditor : public QFrame
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * Constructor.
+       */
+      MultipleSelectionEditor (QWidget *parent = 0);
+
+      /**
+       * Reimplemented from the QWidget class.
+       * Returns the size of the editor.
+       */
+      QSize  sizeHint() const;
+
+      /**
+       * Reimplemented from the QWidget class.
+       */
+      QSize  minimumSizeHint() const;
+
+      /**
+       * Offer the choices of @p pattern.
+       */
+      void set_pattern (const ParameterPattern &pattern);
+
+      /**
+       * Returns the text of the line editor.
+       */
+      QString  text() const;
+
+    public slots:
+      /**
+       * A <tt>slot</tt> to set @p str as text of the line editor.
+       */
+      void setText(const QString &str);
+
+    signals:
+      /**
+       * This <tt>signal</tt> will be emitted, if editing is finished
+       * or choices are selected in the dialog.
+       */
+      void editingFinished();
+
+    private slots:
+      /**
+       * This <tt>slot</tt> should be always called, if editing is finished.
+       */
+      void editing_finished();
+
+      /**
+       * Show the text in red if it contains something that is not a choice.
+       */
+      void check_text(const QString &text);
+
+      /**
+       * Open a @ref MultipleSelectionDialog with the selected choices checked.
+       */
+      void choose();
+
+    private:
+      /**
+       * The pattern of the parameter.
+       */
+      ParameterPattern pattern;
+
+      /**
+       * The line editor.
+       */
+      QLineEdit *line_editor;
+
+      /**
+       * The button that opens the dialog.
+       */
+      QPushButton *choose_button;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
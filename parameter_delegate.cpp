@@ -15,13 +15,23 @@
 
 
 #include "parameter_delegate.h"
-
-#include <limits>
+#include "parameter_item.h"
 
 namespace dealii
 {
   namespace ParameterGui
   {
+    namespace
+    {
+      // the precision of the validators of "Double" editors
+      const unsigned int number_of_decimals = 14;
+
+      // the name of the property that stores the key of an editor in the editor pool
+      const char pool_key_property[] = "parameter_gui_pool_key";
+    }
+
+
+
     ParameterDelegate::ParameterDelegate(const int value_column, QObject *parent)
                      : QItemDelegate(parent)
     {
@@ -61,19 +71,26 @@ namespace dealii
     {
       if (index.column() == value_column)
         {
-          // load pattern description stored in the StatusLine
-          QString pattern_description = index.data(Qt::StatusTipRole).toString();
-
-          QRegExp  rx_string("\\b(FileName|DirectoryName)\\b");
+          const ParameterPattern pattern = pattern_of(index);
 
           // if the type is Filename or DirectoryName
-          if (rx_string.indexIn (pattern_description) != -1)
+          if (pattern.kind == ParameterPattern::file_name ||
+              pattern.kind == ParameterPattern::file_list ||
+              pattern.kind == ParameterPattern::directory_name)
             {
               QString value = index.model()->data(index, Qt::DisplayRole).toString();
 
               QStyleOptionViewItem my_option = option;
               my_option.displayAlignment = Qt::AlignLeft | Qt::AlignVCenter;
 
+              // show paths that do not exist in red, the existence
+              // is checked in the background by the PathChecker
+              if (index.data(ParameterItem::missing_path_role).toBool())
+                {
+                  my_option.palette.setColor(QPalette::Text, Qt::red);
+                  my_option.palette.setColor(QPalette::HighlightedText, Qt::red);
+                }
+
               // print the text in the display
               drawDisplay(painter, my_option, my_option.rect, value);
               // if the line has the focus, print a rectangle
@@ -97,31 +114,45 @@ namespace dealii
     {
       if (index.column() == value_column)
         {
-          // load pattern description stored in the StatusLine
-          QString pattern_description = index.data(Qt::StatusTipRole).toString();
-
-          QRegExp  rx_string("\\b(Anything|MultipleSelection|Map)\\b"),
-                   rx_list("\\b(List)\\b"),
-                   rx_filename("\\b(FileName)\\b"),	
-                   rx_dirname("\\b(DirectoryName)\\b"),	
-                   rx_integer("\\b(Integer)\\b"),
-                   rx_double("\\b(Double|Float|Floating)\\b"),
-                   rx_selection("\\b(Selection)\\b"),
-                   rx_bool("\\b(Bool)\\b");
-
-          // if the type is "Anything" choose a LineEditor
-          if (rx_string.indexIn (pattern_description) != -1)
-            {
-              QLineEdit * line_editor = new QLineEdit(parent);
-              connect(line_editor, SIGNAL(editingFinished()),
-                      this, SLOT(commit_and_close_editor()));
+          const ParameterPattern pattern = pattern_of(index);
+          const QString key = pool_key(pattern);
 
-              return line_editor;
-            }
-          else if (rx_list.indexIn (pattern_description) != -1)
+          // reuse an editor that was closed before, if there is one
+          if (QWidget * editor = reuse_editor(key, pattern, parent))
+            return editor;
+
+          QWidget * editor = 0;
+
+          switch (pattern.kind)
             {
-              // if the type is "List" of files/directories choose a BrowseLineEditor
-              if (rx_filename.indexIn (pattern_description) != -1)
+              // if the type is "Anything" choose a LineEditor
+              case ParameterPattern::anything:
+                {
+                  QLineEdit * line_editor = new QLineEdit(parent);
+                  connect(line_editor, SIGNAL(editingFinished()),
+                          this, SLOT(commit_and_close_editor()));
+
+                  editor = line_editor;
+                  break;
+                }
+
+              // if the type is "List" of something else than files or "Map"
+              // choose a ListEditor, which can show the elements in a table
+              case ParameterPattern::list:
+              case ParameterPattern::map:
+                {
+                  ListEditor * list_editor = new ListEditor(parent);
+                  list_editor->set_pattern(pattern);
+
+                  connect(list_editor, SIGNAL(editingFinished()),
+                          this, SLOT(commit_and_close_editor()));
+
+                  editor = list_editor;
+                  break;
+                }
+
+              // if the type is "List" of files choose a BrowseLineEditor
+              case ParameterPattern::file_list:
                 {
                   BrowseLineEdit * filename_editor =
                       new BrowseLineEdit(BrowseLineEdit::files, parent);
@@ -129,139 +160,125 @@ namespace dealii
                   connect(filename_editor, SIGNAL(editingFinished()),
                           this, SLOT(commit_and_close_editor()));
 
-                  return filename_editor;
+                  editor = filename_editor;
+                  break;
                 }
-              // if the type is "List" of something else choose a LineEditor
-              else
+
+              // if the type is "FileName" choose a BrowseLineEditor
+              case ParameterPattern::file_name:
                 {
-                  QLineEdit * line_editor = new QLineEdit(parent);
+                  BrowseLineEdit * filename_editor =
+                                     new BrowseLineEdit(BrowseLineEdit::file, parent);
 
-                  connect(line_editor, SIGNAL(editingFinished()),
+                  connect(filename_editor, SIGNAL(editingFinished()),
                           this, SLOT(commit_and_close_editor()));
 
-                  return line_editor;
+                  editor = filename_editor;
+                  break;
                 }
-            }
-          // if the type is "FileName" choose a BrowseLineEditor
-          else if (rx_filename.indexIn (pattern_description) != -1)
-            {
-              BrowseLineEdit * filename_editor =
-                                 new BrowseLineEdit(BrowseLineEdit::file, parent);
-
-              connect(filename_editor, SIGNAL(editingFinished()),
-                      this, SLOT(commit_and_close_editor()));
 
-              return filename_editor;
-            }
-          // if the type is "DirectoryName" choose a BrowseLineEditor
-          else if (rx_dirname.indexIn (pattern_description) != -1)
-            {
-              BrowseLineEdit * dirname_editor =
-                                 new BrowseLineEdit(BrowseLineEdit::directory, parent);
+              // if the type is "DirectoryName" choose a BrowseLineEditor
+              case ParameterPattern::directory_name:
+                {
+                  BrowseLineEdit * dirname_editor =
+                                     new BrowseLineEdit(BrowseLineEdit::directory, parent);
 
-              connect(dirname_editor, SIGNAL(editingFinished()),
-                      this, SLOT(commit_and_close_editor()));
+                  connect(dirname_editor, SIGNAL(editingFinished()),
+                          this, SLOT(commit_and_close_editor()));
 
-              return dirname_editor;
-            }
-          // if the type is "Integer" choose a LineEditor with appropriate bounds
-          else if (rx_integer.indexIn (pattern_description) != -1)
-            {
-              const QStringList default_pattern = pattern_description.split(" ").filter("...");
-              const QStringList default_values = default_pattern[0].split("...");
+                  editor = dirname_editor;
+                  break;
+                }
 
-              QLineEdit * line_edit = new QLineEdit(parent);
-              line_edit->setValidator(new QIntValidator(default_values[0].toInt(), default_values[1].toInt(), line_edit));
+              // if the type is "Integer" choose a LineEditor with appropriate bounds
+              case ParameterPattern::integer:
+                {
+                  QLineEdit * line_edit = new QLineEdit(parent);
+                  line_edit->setValidator(new QIntValidator(pattern.min_integer,
+                                                            pattern.max_integer,
+                                                            line_edit));
 
-              connect(line_edit, SIGNAL(editingFinished()),
-                      this, SLOT(commit_and_close_editor()));
+                  connect(line_edit, SIGNAL(editingFinished()),
+                          this, SLOT(commit_and_close_editor()));
 
-              return line_edit;
-            }
-          // if the type is "Double" choose a LineEditor with appropriate bounds
-          else if (rx_double.indexIn (pattern_description) != -1)
-            {
-              const QStringList default_pattern = pattern_description.split(" ").filter("...");
-              QStringList default_values = default_pattern[0].split("...");
+                  editor = line_edit;
+                  break;
+                }
 
-              // Unfortunately conversion of MAX_DOUBLE to string and back fails
-              // sometimes, therefore use MAX_DOUBLE/2 to make sure we are below.
-              // In practice MAX_DOUBLE just means VERY large, it is normally not
-              // important how large.
-              const double max_double = std::numeric_limits<double>::max()/2;
-              default_values = default_values.replaceInStrings("MAX_DOUBLE",
-                                                               QVariant(max_double).toString());
+              // if the type is "Double" choose a LineEditor with appropriate bounds
+              case ParameterPattern::floating_point:
+                {
+                  QLineEdit * line_edit = new QLineEdit(parent);
+                  line_edit->setValidator(new QDoubleValidator(pattern.min_double,
+                                                               pattern.max_double,
+                                                               number_of_decimals,
+                                                               line_edit));
 
-              const unsigned int number_of_decimals = 14;
+                  connect(line_edit, SIGNAL(editingFinished()),
+                          this, SLOT(commit_and_close_editor()));
 
-              QLineEdit * line_edit = new QLineEdit(parent);
-              line_edit->setValidator(new QDoubleValidator(default_values[0].toDouble(),
-                                                           default_values[1].toDouble(),
-                                                           number_of_decimals,
-                                                           line_edit));
+                  editor = line_edit;
+                  break;
+                }
 
-              connect(line_edit, SIGNAL(editingFinished()),
-                      this, SLOT(commit_and_close_editor()));
+              // if the type is "Selection" choose a SelectionEditor,
+              // which only shows the choices that are scrolled into view
+              case ParameterPattern::selection:
+                {
+                  SelectionEditor * selection_editor = new SelectionEditor(parent);
+                  selection_editor->set_pattern(pattern);
 
-              return line_edit;
-            }
-          // if the type is "Selection" choose a ComboBox
-          else if (rx_selection.indexIn (pattern_description) != -1)
-            {
-              QComboBox * combo_box = new QComboBox(parent);
+                  connect(selection_editor, SIGNAL(editingFinished()),
+                          this, SLOT(commit_and_close_editor()));
 
-              // we assume, that pattern_description is of the form
-              // "Type: [Selection item1|item2| ....|item ]".
-              // Find the first space after the first '[',
-              // which indicates the start of the first option
-              int begin_pattern = pattern_description.indexOf("[");
-              begin_pattern = pattern_description.indexOf(" ",begin_pattern) + 1;
+                  editor = selection_editor;
+                  break;
+                }
 
-              // Find the last ']', which signals the end of the options
-              const int end_pattern = pattern_description.lastIndexOf("]");
+              // if the type is "MultipleSelection" choose a MultipleSelectionEditor,
+              // which can show the choices in a list with check boxes
+              case ParameterPattern::multiple_selection:
+                {
+                  MultipleSelectionEditor * multiple_selection_editor = new MultipleSelectionEditor(parent);
+                  multiple_selection_editor->set_pattern(pattern);
 
-              // Extract the options from the string
-              QString pattern = pattern_description.mid(begin_pattern,end_pattern-begin_pattern);
+                  connect(multiple_selection_editor, SIGNAL(editingFinished()),
+                          this, SLOT(commit_and_close_editor()));
 
-              // Remove trailing whitespaces
-              while (pattern.endsWith(' '))
-                pattern.chop(1);
+                  editor = multiple_selection_editor;
+                  break;
+                }
 
-              // Split the list
-              const QStringList choices = pattern.split("|");
-              combo_box->addItems(choices);
+              // if the type is "Bool" choose a ComboBox
+              case ParameterPattern::boolean:
+                {
+                  QComboBox * combo_box = new QComboBox(parent);
 
-              combo_box->setEditable(false);
+                  std::vector<std::string> choices;
+                  choices.push_back(std::string("true"));
+                  choices.push_back(std::string("false"));
 
-              connect(combo_box, SIGNAL(currentIndexChanged(int)),
-                      this, SLOT(commit_and_close_editor()));
+                  // add items to the combo box
+                  for (unsigned int i=0; i<choices.size(); ++i)
+                    combo_box->addItem (tr(choices[i].c_str()), tr(choices[i].c_str()));
 
-              return combo_box;
-           }
-          // if the type is "Bool" choose a ComboBox
-          else if (rx_bool.indexIn (pattern_description) != -1)
-            {
-              QComboBox * combo_box = new QComboBox(parent);
+                  combo_box->setEditable(false);
 
-              std::vector<std::string> choices;
-              choices.push_back(std::string("true"));
-              choices.push_back(std::string("false"));
+                  connect(combo_box, SIGNAL(currentIndexChanged(int)),
+                          this, SLOT(commit_and_close_editor()));
 
-              // add items to the combo box
-              for (unsigned int i=0; i<choices.size(); ++i)
-                combo_box->addItem (tr(choices[i].c_str()), tr(choices[i].c_str()));
+                  editor = combo_box;
+                  break;
+                }
 
-              combo_box->setEditable(false);
+              default:
+                return QItemDelegate::createEditor(parent, option, index);
+            };
 
-              connect(combo_box, SIGNAL(currentIndexChanged(int)),
-                      this, SLOT(commit_and_close_editor()));
+          // remember which editors this one can be reused for
+          editor->setProperty(pool_key_property, key);
 
-              return combo_box;
-            }
-          else
-            {
-              return QItemDelegate::createEditor(parent, option, index);
-            };
+          return editor;
         };
 
       // if it is not the column "parameter values", do nothing
@@ -279,14 +296,29 @@ namespace dealii
               QString file_name = index.data(Qt::DisplayRole).toString();
               filename_editor->setText(file_name);
             }
+          else if (SelectionEditor * selection_editor = qobject_cast<SelectionEditor *>(editor))
+            {
+              selection_editor->setText(index.data(Qt::DisplayRole).toString());
+            }
+          else if (ListEditor * list_editor = qobject_cast<ListEditor *>(editor))
+            {
+              list_editor->setText(index.data(Qt::DisplayRole).toString());
+            }
+          else if (MultipleSelectionEditor * multiple_selection_editor = qobject_cast<MultipleSelectionEditor *>(editor))
+            {
+              multiple_selection_editor->setText(index.data(Qt::DisplayRole).toString());
+            }
           else if (QComboBox * combo_box = qobject_cast<QComboBox *>(editor))
             {
-              QRegExp  rx(index.data(Qt::DisplayRole).toString());
-
-              // Preset ComboBox to the current selection
-              for (int i=0; i<combo_box->count(); ++i)
-                if (rx.exactMatch(combo_box->itemText(i)))
-                  combo_box->setCurrentIndex(i);
+              // Preset ComboBox to the current selection. A reused combo box still
+              // shows the selection of the last edit, changing it must not be
+              // taken as a new choice of the user.
+              const int current = combo_box->findText(index.data(Qt::DisplayRole).toString());
+
+              const bool signals_blocked = combo_box->blockSignals(true);
+              if (current != -1)
+                combo_box->setCurrentIndex(current);
+              combo_box->blockSignals(signals_blocked);
             }
           else
             QItemDelegate::setEditorData(editor, index);
@@ -295,6 +327,67 @@ namespace dealii
 
 
 
+#if QT_VERSION >= 0x050000
+    void ParameterDelegate::destroyEditor(QWidget *editor, const QModelIndex &index) const
+    {
+      const QString key = editor->property(pool_key_property).toString();
+
+      // keep one closed editor per key, the view only opens one editor at a time
+      if (key.isEmpty() || !editor_pool.value(key).isNull())
+        QItemDelegate::destroyEditor(editor, index);
+      else
+        editor_pool.insert(key, QPointer<QWidget>(editor));
+    }
+#endif
+
+
+
+    QString ParameterDelegate::pool_key(const ParameterPattern &pattern) const
+    {
+      // editors only depend on the kind, the pattern
+      // is set again when they are reused
+      return QString::number(pattern.kind);
+    }
+
+
+
+    QWidget *ParameterDelegate::reuse_editor(const QString &key,
+                                             const ParameterPattern &pattern,
+                                             QWidget *parent) const
+    {
+      QPointer<QWidget> editor = editor_pool.take(key);
+
+      // the editor may have been deleted together with its parent
+      if (editor.isNull())
+        return 0;
+
+      if (editor->parentWidget() != parent)
+        editor->setParent(parent);
+
+      // the bounds of numeric patterns differ between parameters of the same kind
+      if (QIntValidator * validator = editor->findChild<QIntValidator *>())
+        validator->setRange(pattern.min_integer, pattern.max_integer);
+      else if (QDoubleValidator * validator = editor->findChild<QDoubleValidator *>())
+        validator->setRange(pattern.min_double, pattern.max_double, number_of_decimals);
+      else if (SelectionEditor * selection_editor = qobject_cast<SelectionEditor *>(editor.data()))
+        selection_editor->set_pattern(pattern);
+      else if (ListEditor * list_editor = qobject_cast<ListEditor *>(editor.data()))
+        list_editor->set_pattern(pattern);
+      else if (MultipleSelectionEditor * multiple_selection_editor = qobject_cast<MultipleSelectionEditor *>(editor.data()))
+        multiple_selection_editor->set_pattern(pattern);
+
+      return editor;
+    }
+
+
+
+    ParameterPattern ParameterDelegate::pattern_of(const QModelIndex &index) const
+    {
+      return ParameterPattern::get(index.data(ParameterItem::pattern_description_role).toString());
+    }
+
+
+
     void ParameterDelegate::commit_and_close_editor()
     {
       QWidget * editor = qobject_cast<QWidget *>(sender());
@@ -331,6 +424,25 @@ namespace dealii
               QString value = filename_editor->text();
               model->setData(index, value);
             }
+          else if (ListEditor * list_editor = qobject_cast<ListEditor *>(editor))
+            {
+              QString value = list_editor->text();
+              model->setData(index, value);
+            }
+          else if (MultipleSelectionEditor * multiple_selection_editor = qobject_cast<MultipleSelectionEditor *>(editor))
+            {
+              // values with parts that are not choices are dropped
+              const QString value = multiple_selection_editor->text();
+              if (pattern_of(index).is_valid(value))
+                model->setData(index, value);
+            }
+          else if (SelectionEditor * selection_editor = qobject_cast<SelectionEditor *>(editor))
+            {
+              // text that is only the beginning of a choice is dropped
+              const QString value = selection_editor->text();
+              if (pattern_of(index).is_valid(value))
+                model->setData(index, value);
+            }
           else if (QComboBox * combo_box = qobject_cast<QComboBox *>(editor))
             {
               QString value = combo_box->currentText();
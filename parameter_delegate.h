@@ -23,8 +23,14 @@
 #include <QLineEdit>
 #include <QComboBox>
 #include <QFileDialog>
+#include <QHash>
+#include <QPointer>
 
 #include "browse_lineedit.h"
+#include "list_editor.h"
+#include "multiple_selection_editor.h"
+#include "parameter_pattern.h"
+#include "selection_editor.h"
 
 
 namespace dealii
@@ -38,9 +44,9 @@ namespace dealii
      * The ParameterDelegate class implements special delegates for the QTreeWidget class used in the parameterGUI.
      * The QTreeWidget class provides some different standard delegates for editing parameters shown in the
      * tree structure. The ParameterDelegate class provides special editors for the different types of parameters defined in
-     * the ParameterHandler class. For all parameter types based on strings as &quot;Anything&quot;, &quot;MultipleSelection&quot; &quot;Map&quot; and
-     * &quot;List&quot; a simple line editor will be shown up. In the case of integer and double type parameters the editor is a spin box and for
-     * &quot;Selection&quot; type parameters a combo box will be shown up. For parameters of type &quot;FileName&quot; and &quot;DirectoryName&quot;
+     * the ParameterHandler class. For &quot;Anything&quot; a simple line editor will be shown up, for &quot;Map&quot; and
+     * &quot;List&quot; a @ref ListEditor and for &quot;MultipleSelection&quot; a @ref MultipleSelectionEditor. In the case of integer and double type parameters the editor is a spin box and for
+     * &quot;Selection&quot; type parameters a @ref SelectionEditor will be shown up. For parameters of type &quot;FileName&quot; and &quot;DirectoryName&quot;
      * the delegate shows a @ref BrowseLineEdit editor. The column of the tree structure with the parameter values has to be set
      * in the constructor.
      *
@@ -89,6 +95,16 @@ namespace dealii
       void setModelData(QWidget *editor, QAbstractItemModel *model,
                         const QModelIndex &index) const;
 
+#if QT_VERSION >= 0x050000
+      /**
+       * Reimplemented from QAbstractItemDelegate.
+       * Instead of deleting a closed editor, it is kept in <tt>editor_pool</tt>
+       * to be reused by the next call of @ref createEditor for a parameter with
+       * the same kind of pattern.
+       */
+      void destroyEditor(QWidget *editor, const QModelIndex &index) const;
+#endif
+
     private slots:
       /**
        * Reimplemented from QItemDelegate.
@@ -96,10 +112,37 @@ namespace dealii
       void commit_and_close_editor();
 
     private:
+      /**
+       * Return the pattern of the parameter at @p index. The pattern
+       * is parsed only once for all parameters with the same description.
+       */
+      ParameterPattern pattern_of(const QModelIndex &index) const;
+
+      /**
+       * Return the key under which editors for parameters with
+       * @p pattern are stored in <tt>editor_pool</tt>.
+       */
+      QString pool_key(const ParameterPattern &pattern) const;
+
+      /**
+       * Take the editor stored under @p key out of <tt>editor_pool</tt> and prepare it
+       * for editing a parameter with @p pattern in @p parent. Returns 0 if there is no
+       * editor to reuse.
+       */
+      QWidget *reuse_editor(const QString &key,
+                            const ParameterPattern &pattern,
+                            QWidget *parent) const;
+
       /**
        * The column this delegate will be used on.
        */
       int value_column;
+
+      /**
+       * Closed editors that can be reused, stored by the key returned by @ref pool_key.
+       * Creating the widgets and validators is much more expensive than resetting their state.
+       */
+      mutable QHash<QString, QPointer<QWidget> > editor_pool;
     };
   }
   /**@}*/
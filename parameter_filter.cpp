@@ -0,0 +1,142 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_filter.h"
+#include "parameter_item.h"
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    ParameterFilter::ParameterFilter()
+                   : options(0)
+    {
+    }
+
+
+
+    void ParameterFilter::set_option(const Option option,
+                                     const bool   enabled)
+    {
+      if (enabled)
+        options |= option;
+      else
+        options &= ~option;
+    }
+
+
+
+    bool ParameterFilter::has_option(const Option option) const
+    {
+      return (options & option) != 0;
+    }
+
+
+
+    void ParameterFilter::set_text(const QString &text)
+    {
+      this->text = text;
+    }
+
+
+
+    bool ParameterFilter::accepts(const QTreeWidgetItem *item) const
+    {
+      bool in_matching_section = false;
+
+      if (!text.isEmpty())
+        for (const QTreeWidgetItem *parent = item->parent();
+             parent != 0 && !in_matching_section;
+             parent = parent->parent())
+          in_matching_section = contains_text(parent);
+
+      return accepts(item, in_matching_section);
+    }
+
+
+
+    bool ParameterFilter::accepts(const QTreeWidgetItem *item,
+                                  const bool             in_matching_section) const
+    {
+      if (has_option(hide_defaults) && ParameterItem::has_default_value(item))
+        return false;
+
+      if (has_option(only_modified) && !ParameterItem::is_modified(item))
+        return false;
+
+      if (has_option(only_invalid) && ParameterItem::is_valid(item))
+        return false;
+
+      // the parameters of a subsection found by its name are all shown
+      if (!text.isEmpty() && !in_matching_section && !contains_text(item))
+        return false;
+
+      return true;
+    }
+
+
+
+    bool ParameterFilter::contains_text(const QTreeWidgetItem *item) const
+    {
+      return item->text(0).contains(text, Qt::CaseInsensitive) ||
+             item->text(1).contains(text, Qt::CaseInsensitive);
+    }
+
+
+
+    void ParameterFilter::apply(QTreeWidget *tree_widget) const
+    {
+      // the view lays out its items once when control returns to the event
+      // loop, disabling its updates only avoids painting it in between
+      const bool updates_enabled = tree_widget->updatesEnabled();
+      tree_widget->setUpdatesEnabled(false);
+
+      for (int i = 0; i < tree_widget->topLevelItemCount(); ++i)
+        apply(tree_widget->topLevelItem(i), false);
+
+      tree_widget->setUpdatesEnabled(updates_enabled);
+    }
+
+
+
+    bool ParameterFilter::apply(QTreeWidgetItem *item,
+                                const bool       in_matching_section) const
+    {
+      bool visible = false;
+
+      if (item->childCount() == 0)
+        visible = accepts(item, in_matching_section);
+      else
+        {
+          const bool matching_section = in_matching_section ||
+                                        (!text.isEmpty() && contains_text(item));
+
+          // a subsection is shown if any of its children is shown,
+          // but we have to visit all children to update them
+          for (int i = 0; i < item->childCount(); ++i)
+            {
+              const bool child_visible = apply(item->child(i), matching_section);
+              visible = visible || child_visible;
+            }
+        }
+
+      if (item->isHidden() == visible)
+        item->setHidden(!visible);
+
+      return visible;
+    }
+  }
+}
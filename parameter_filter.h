@@ -0,0 +1,140 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERFILTER_H
+#define PARAMETERFILTER_H
+
+#include <QString>
+#include <QTreeWidget>
+#include <QTreeWidgetItem>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterFilter class decides which items of the parameter tree are shown.
+     * A parameter is shown if it satisfies all active filter options and contains the
+     * filter text in its name or value, or is in a subsection whose name contains the
+     * text. A subsection is shown if any of its parameters is shown.
+     *
+     * The QTreeWidget owns its model, so we can not put a QSortFilterProxyModel between
+     * the model and the view. Instead, @ref apply computes the visibility of all items in
+     * a single pass over the tree and only changes the items whose visibility actually
+     * changes. Every change still marks the layout of the view as outdated, but the view
+     * postpones laying out its items until control returns to the event loop, so it does
+     * so once per change of the filter.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterFilter
+    {
+    public:
+      /**
+       * The options of the filter, which can be combined.
+       */
+      enum Option
+      {
+        /**
+         * Hide parameters that have their default value.
+         */
+        hide_defaults = 1,
+        /**
+         * Only show parameters that were modified since the file was loaded.
+         */
+        only_modified = 2,
+        /**
+         * Only show parameters whose value does not satisfy their pattern.
+         */
+        only_invalid = 4
+      };
+
+      /**
+       * Constructor. No option is set and the filter text is empty,
+       * so all items are shown.
+       */
+      ParameterFilter ();
+
+      /**
+       * Set or unset @p option.
+       */
+      void set_option (const Option option,
+                       const bool   enabled);
+
+      /**
+       * Return whether @p option is set.
+       */
+      bool has_option (const Option option) const;
+
+      /**
+       * Only show parameters that contain @p text in their name or value.
+       * The comparison is case insensitive.
+       */
+      void set_text (const QString &text);
+
+      /**
+       * Return whether the parameter @p item should be shown.
+       */
+      bool accepts (const QTreeWidgetItem *item) const;
+
+      /**
+       * Show and hide the items of @p tree_widget according to the filter.
+       */
+      void apply (QTreeWidget *tree_widget) const;
+
+    private:
+      /**
+       * Return whether the parameter @p item should be shown. @p in_matching_section
+       * tells whether the name of one of its subsections contains the filter text.
+       */
+      bool accepts (const QTreeWidgetItem *item,
+                    const bool             in_matching_section) const;
+
+      /**
+       * Return whether the name or the value of @p item contains the filter text.
+       */
+      bool contains_text (const QTreeWidgetItem *item) const;
+
+      /**
+       * Show or hide @p item and its children recursively. @p in_matching_section
+       * is passed on to @ref accepts. Returns true if @p item is shown.
+       */
+      bool apply (QTreeWidgetItem *item,
+                  const bool       in_matching_section) const;
+
+      /**
+       * The set options, a combination of the values of <tt>Option</tt>.
+       */
+      int  options;
+
+      /**
+       * The filter text.
+       */
+      QString  text;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
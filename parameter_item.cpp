@@ -0,0 +1,107 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_item.h"
+#include "parameter_pattern.h"
+#include "parameter_value.h"
+
+#include <QTreeWidget>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace ParameterItem
+    {
+      void store_reference_values (QTreeWidgetItem *item)
+      {
+        const ParameterPattern pattern
+          = ParameterPattern::get(item->data(1,pattern_description_role).toString());
+
+        item->setData(1, default_value_role,
+                      QVariant::fromValue(ParameterValue::from_variant(item->text(2), pattern)));
+        const QVariant value
+          = QVariant::fromValue(ParameterValue::from_variant(item->data(1,Qt::DisplayRole), pattern));
+        item->setData(1, original_value_role, value);
+        item->setData(1, value_role, value);
+        item->setData(1, committed_value_role, item->data(1,Qt::EditRole));
+      }
+
+
+
+      void update_value (QTreeWidgetItem *item)
+      {
+        const ParameterPattern pattern
+          = ParameterPattern::get(item->data(1,pattern_description_role).toString());
+
+        // storing the converted value is no change of the parameter
+        QTreeWidget *tree_widget = item->treeWidget();
+        const bool signals_blocked = tree_widget && tree_widget->blockSignals(true);
+
+        item->setData(1, value_role,
+                      QVariant::fromValue(ParameterValue::from_variant(item->data(1,Qt::DisplayRole), pattern)));
+
+        if (tree_widget)
+          tree_widget->blockSignals(signals_blocked);
+      }
+
+
+
+      QString path (const QTreeWidgetItem *item)
+      {
+        QString result = item->text(0);
+
+        for (const QTreeWidgetItem *parent = item->parent(); parent != 0; parent = parent->parent())
+          result.prepend(parent->text(0) + "/");
+
+        return result;
+      }
+
+
+
+      bool has_default_value (const QTreeWidgetItem *item)
+      {
+        // subsections have no value, so it can not differ from the default
+        const QVariant default_value = item->data(1,default_value_role);
+        if (!default_value.isValid())
+          return true;
+
+        return item->data(1,value_role).value<ParameterValue>() == default_value.value<ParameterValue>();
+      }
+
+
+
+      bool is_modified (const QTreeWidgetItem *item)
+      {
+        // subsections have no value and are never modified
+        const QVariant original_value = item->data(1,original_value_role);
+        if (!original_value.isValid())
+          return false;
+
+        return item->data(1,value_role).value<ParameterValue>() != original_value.value<ParameterValue>();
+      }
+
+
+
+      bool is_valid (const QTreeWidgetItem *item)
+      {
+        const ParameterPattern pattern
+          = ParameterPattern::get(item->data(1,pattern_description_role).toString());
+        return pattern.is_valid(item->data(1,Qt::DisplayRole).toString());
+      }
+    }
+  }
+}
@@ -0,0 +1,123 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERITEM_H
+#define PARAMETERITEM_H
+
+#include <QTreeWidgetItem>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * A parameter is stored in a QTreeWidgetItem with its name in column 0, its value
+     * in column 1, and the default value, documentation, pattern and pattern description
+     * as text in the columns 2 to 5. Only the first two columns are shown, so the model
+     * of the tree does not provide indices for the others. Information that editors
+     * and views need to access through a QModelIndex is therefore additionally stored
+     * in column 1 under the following roles. The functions in this namespace answer
+     * questions about such parameter items that are needed in several places.
+     *
+     * @ingroup ParameterGui
+     */
+    namespace ParameterItem
+    {
+      enum DataRole
+      {
+        /**
+         * The <tt>pattern_description</tt> of the parameter as a QString.
+         */
+        pattern_description_role = Qt::UserRole,
+
+        /**
+         * The default value of the parameter as a ParameterValue.
+         */
+        default_value_role,
+
+        /**
+         * The value of the parameter as it was read from the file, as a ParameterValue.
+         */
+        original_value_role,
+
+        /**
+         * The current value of the parameter as a ParameterValue, see update_value().
+         * Comparing it to the default and original value needs neither the pattern
+         * nor the text of the value.
+         */
+        value_role,
+
+        /**
+         * The value of the parameter after its last change recorded in the edit log.
+         * Comparing it to the current value tells which value a change replaced.
+         */
+        committed_value_role,
+
+        /**
+         * Whether a file or directory the value of a &quot;FileName&quot; or
+         * &quot;DirectoryName&quot; parameter names is known not to exist, as a bool.
+         */
+        missing_path_role
+      };
+
+      /**
+       * Store the default value and the current value of the parameter @p item as
+       * its <tt>default_value_role</tt>, <tt>original_value_role</tt>, <tt>value_role</tt>
+       * and <tt>committed_value_role</tt>. This has
+       * to be done once the value and the <tt>pattern_description_role</tt> of a
+       * newly read parameter are set.
+       */
+      void store_reference_values (QTreeWidgetItem *item);
+
+      /**
+       * Store the current value of the parameter @p item as its <tt>value_role</tt>.
+       * This has to be done whenever the value changes, before has_default_value()
+       * or is_modified() are asked. The signals of the tree are blocked meanwhile.
+       */
+      void update_value (QTreeWidgetItem *item);
+
+      /**
+       * Return the path of @p item, i.e. the names of the subsections it is
+       * nested in and its own name, separated by &quot;/&quot;.
+       */
+      QString path (const QTreeWidgetItem *item);
+
+      /**
+       * Return whether the parameter @p item has its default value.
+       */
+      bool has_default_value (const QTreeWidgetItem *item);
+
+      /**
+       * Return whether the value of the parameter @p item differs from
+       * the value it had when the file was loaded.
+       */
+      bool is_modified (const QTreeWidgetItem *item);
+
+      /**
+       * Return whether the value of the parameter @p item satisfies its pattern.
+       */
+      bool is_valid (const QTreeWidgetItem *item);
+    }
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,156 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_layers.h"
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    void ParameterLayers::clear ()
+    {
+      layers.clear();
+      base_values.clear();
+    }
+
+
+
+    int ParameterLayers::size () const
+    {
+      return layers.size();
+    }
+
+
+
+    QString ParameterLayers::name (const int layer) const
+    {
+      return layers[layer].name;
+    }
+
+
+
+    QHash<int, QString> ParameterLayers::values (const int layer) const
+    {
+      return layers[layer].values;
+    }
+
+
+
+    int ParameterLayers::layer_of (const int id) const
+    {
+      for (int layer = layers.size()-1; layer >= 0; --layer)
+        if (layers[layer].values.contains(id))
+          return layer;
+
+      return -1;
+    }
+
+
+
+    bool ParameterLayers::value_below_top (const int  id,
+                                           QString   &value) const
+    {
+      if (!base_values.contains(id))
+        return false;
+
+      value = resolve(id, layers.size()-1);
+      return true;
+    }
+
+
+
+    QHash<int, QString> ParameterLayers::push (const QString             &name,
+                                               const QHash<int, QString> &values,
+                                               const QHash<int, QString> &current_values)
+    {
+      store_base_values(values, current_values);
+
+      Layer layer;
+      layer.name = name;
+      layer.values = values;
+      layers.append(layer);
+
+      // the new layer is on top, so all of its values are shown
+      return values;
+    }
+
+
+
+    QHash<int, QString> ParameterLayers::replace (const int                  layer,
+                                                  const QHash<int, QString> &values,
+                                                  const QHash<int, QString> &current_values)
+    {
+      store_base_values(values, current_values);
+
+      const QHash<int, QString> old_values = layers[layer].values;
+      layers[layer].values = values;
+
+      // only the parameters the layer set before or sets now are affected,
+      // and only if no layer above sets them
+      QHash<int, QString> updates;
+      for (QHash<int, QString>::const_iterator p = old_values.constBegin(); p != old_values.constEnd(); ++p)
+        if (layer_of(p.key()) <= layer)
+          updates.insert(p.key(), resolve(p.key(), layers.size()));
+
+      for (QHash<int, QString>::const_iterator p = values.constBegin(); p != values.constEnd(); ++p)
+        if (layer_of(p.key()) == layer)
+          updates.insert(p.key(), p.value());
+
+      return updates;
+    }
+
+
+
+    QHash<int, QString> ParameterLayers::pop ()
+    {
+      const QHash<int, QString> removed = layers.last().values;
+      layers.pop_back();
+
+      QHash<int, QString> updates;
+      for (QHash<int, QString>::const_iterator p = removed.constBegin(); p != removed.constEnd(); ++p)
+        updates.insert(p.key(), resolve(p.key(), layers.size()));
+
+      return updates;
+    }
+
+
+
+    void ParameterLayers::store_base_values (const QHash<int, QString> &values,
+                                             const QHash<int, QString> &current_values)
+    {
+      for (QHash<int, QString>::const_iterator p = values.constBegin(); p != values.constEnd(); ++p)
+        if (!base_values.contains(p.key()))
+          base_values.insert(p.key(), current_values.value(p.key()));
+    }
+
+
+
+    QString ParameterLayers::resolve (const int id,
+                                      const int end) const
+    {
+      for (int layer = end-1; layer >= 0; --layer)
+        {
+          const QHash<int, QString>::const_iterator
+            p = layers[layer].values.constFind(id);
+
+          if (p != layers[layer].values.constEnd())
+            return p.value();
+        }
+
+      return base_values.value(id);
+    }
+  }
+}
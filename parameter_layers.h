@@ -0,0 +1,150 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERLAYERS_H
+#define PARAMETERLAYERS_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterLayers class manages a stack of layers of parameter values applied
+     * on top of the parameter file, e.g. the site, cluster and run-level PRM files of
+     * a configuration. Every layer is stored as the values it sets by parameter id
+     * (see @ref ParameterPathIndex). The value of a parameter is that of the topmost
+     * layer setting it, or its base value, the value it had before the first layer
+     * setting it was added, which is stored for these parameters only.
+     *
+     * All functions that change the stack return the values of the parameters that
+     * have to be updated in the tree: adding a layer only affects the parameters it
+     * sets, and replacing or removing a layer only the parameters it set before or
+     * sets now and that are not set by a layer above it.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterLayers
+    {
+    public:
+      /**
+       * Remove all layers.
+       */
+      void clear ();
+
+      /**
+       * Return the number of layers.
+       */
+      int size () const;
+
+      /**
+       * Return the name of @p layer, the bottom layer is 0.
+       */
+      QString name (const int layer) const;
+
+      /**
+       * Return the values @p layer sets by parameter id.
+       */
+      QHash<int, QString> values (const int layer) const;
+
+      /**
+       * Return the topmost layer that sets the parameter @p id,
+       * or -1 if its value is not set by any layer.
+       */
+      int layer_of (const int id) const;
+
+      /**
+       * Return in @p value the value the parameter @p id would have without the
+       * top layer. Returns false if the parameter is not set by any layer and
+       * has no base value.
+       */
+      bool value_below_top (const int  id,
+                            QString   &value) const;
+
+      /**
+       * Add the layer @p name with @p values on top. @p current_values are the
+       * values of the same parameters in the tree, which are stored as the base
+       * values of parameters that were not set by a layer before. Returns the
+       * values of the parameters to update.
+       */
+      QHash<int, QString> push (const QString             &name,
+                                const QHash<int, QString> &values,
+                                const QHash<int, QString> &current_values);
+
+      /**
+       * Replace the values of @p layer by @p values, e.g. after its file was changed.
+       * @p current_values are used as for @ref push. Returns the values of the
+       * parameters to update.
+       */
+      QHash<int, QString> replace (const int                  layer,
+                                   const QHash<int, QString> &values,
+                                   const QHash<int, QString> &current_values);
+
+      /**
+       * Remove the top layer. Returns the values of the parameters to update.
+       */
+      QHash<int, QString> pop ();
+
+    private:
+      /**
+       * Store @p current_values as the base values of the parameters in @p values
+       * that do not have one yet.
+       */
+      void store_base_values (const QHash<int, QString> &values,
+                              const QHash<int, QString> &current_values);
+
+      /**
+       * Return the value of the parameter @p id given by the layers below
+       * @p end, or its base value.
+       */
+      QString resolve (const int id,
+                       const int end) const;
+
+      /**
+       * A layer of parameter values.
+       */
+      struct Layer
+      {
+        QString              name;
+        QHash<int, QString>  values;
+      };
+
+      /**
+       * The layers, the bottom layer first.
+       */
+      QVector<Layer> layers;
+
+      /**
+       * The values of the parameters set by any layer before the first of these layers was added.
+       */
+      QHash<int, QString> base_values;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,337 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_linter.h"
+#include "parameter_pattern.h"
+#include "prm_parameter_reader.h"
+#include "xml_parameter_reader.h"
+
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QObject>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QXmlStreamWriter>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // Checks one file and stores the result in the report reserved for it.
+      class LintJob : public QRunnable
+      {
+      public:
+        LintJob (const ParameterLinter          &linter,
+                 const QString                  &file_name,
+                 ParameterLinter::FileReport    *report)
+          : linter(linter),
+            file_name(file_name),
+            report(report)
+        {
+        }
+
+        void run ()
+        {
+          *report = linter.lint_file(file_name);
+        }
+
+      private:
+        const ParameterLinter        &linter;
+        const QString                 file_name;
+        ParameterLinter::FileReport  *report;
+      };
+
+
+
+      void add_issue (ParameterLinter::FileReport &report,
+                      const QString               &path,
+                      const QString               &value,
+                      const QString               &message)
+      {
+        ParameterLinter::Issue issue;
+        issue.path = path;
+        issue.value = value;
+        issue.message = message;
+        report.issues.append(issue);
+      }
+    }
+
+
+
+    bool ParameterLinter::set_schema (QIODevice *device)
+    {
+      QVector<XMLParameterReader::Parameter> parameters;
+      if (!XMLParameterReader::read_parameters(device, parameters, error))
+        return false;
+
+      schema.clear();
+      foreach (const XMLParameterReader::Parameter &parameter, parameters)
+        schema.insert(parameter.path, parameter.pattern_description);
+
+      return true;
+    }
+
+
+
+    QStringList ParameterLinter::parameter_files (const QStringList &paths)
+    {
+      QStringList file_names;
+
+      foreach (const QString &path, paths)
+        if (QFileInfo(path).isDir())
+          {
+            QStringList found;
+            QDirIterator it(path, QStringList() << "*.xml" << "*.prm",
+                            QDir::Files, QDirIterator::Subdirectories);
+            while (it.hasNext())
+              found.append(it.next());
+
+            found.sort();
+            file_names += found;
+          }
+        else
+          file_names.append(path);
+
+      return file_names;
+    }
+
+
+
+    QVector<ParameterLinter::FileReport>
+    ParameterLinter::lint (const QStringList &file_names) const
+    {
+      QVector<FileReport> reports(file_names.size());
+      FileReport *results = reports.data();
+
+      // every job writes to its own report, so they need no synchronization
+      QThreadPool pool;
+      for (int i = 0; i < file_names.size(); ++i)
+        pool.start(new LintJob(*this, file_names[i], results + i));
+
+      pool.waitForDone();
+
+      return reports;
+    }
+
+
+
+    ParameterLinter::FileReport
+    ParameterLinter::lint_file (const QString &file_name) const
+    {
+      FileReport report;
+      report.file_name = file_name;
+
+      QFile file(file_name);
+      if (!file.open(QFile::ReadOnly | QFile::Text))
+        {
+          report.error = QObject::tr("Cannot read file: %1").arg(file.errorString());
+          return report;
+        }
+
+      // referenced files are relative to the parameter file
+      const QDir directory = QFileInfo(file_name).absoluteDir();
+
+      if (file_name.endsWith(".prm", Qt::CaseInsensitive))
+        {
+          if (schema.isEmpty())
+            {
+              report.error = QObject::tr("A schema is needed to check PRM files.");
+              return report;
+            }
+
+          PRMParameterReader reader;
+          if (!reader.read_prm_file(&file))
+            {
+              report.error = reader.error_string();
+              return report;
+            }
+
+          const QHash<QString, QString> values = reader.values();
+          QStringList paths = values.keys();
+          paths.sort();
+
+          foreach (const QString &path, paths)
+            {
+              const QHash<QString, QString>::const_iterator
+                pattern_description = schema.constFind(path);
+
+              if (pattern_description == schema.constEnd())
+                add_issue(report, path, values[path],
+                          QObject::tr("The parameter is not in the schema."));
+              else
+                check(path, values[path], pattern_description.value(), directory, report);
+            }
+        }
+      else
+        {
+          QVector<XMLParameterReader::Parameter> parameters;
+          if (!XMLParameterReader::read_parameters(&file, parameters, report.error))
+            return report;
+
+          foreach (const XMLParameterReader::Parameter &parameter, parameters)
+            {
+              if (!schema.isEmpty() && !schema.contains(parameter.path))
+                add_issue(report, parameter.path, parameter.value,
+                          QObject::tr("The parameter is not in the schema."));
+
+              check(parameter.path, parameter.value, parameter.pattern_description,
+                    directory, report);
+            }
+        }
+
+      return report;
+    }
+
+
+
+    void ParameterLinter::write_report (const QVector<FileReport> &reports,
+                                        QIODevice                 *device)
+    {
+      int files_with_problems = 0;
+      foreach (const FileReport &report, reports)
+        if (!report.error.isEmpty() || !report.issues.isEmpty())
+          ++files_with_problems;
+
+      QXmlStreamWriter xml(device);
+      xml.setAutoFormatting(true);
+      xml.writeStartDocument();
+
+      xml.writeStartElement("lint_report");
+      xml.writeAttribute("files", QString::number(reports.size()));
+      xml.writeAttribute("files_with_problems", QString::number(files_with_problems));
+
+      foreach (const FileReport &report, reports)
+        {
+          xml.writeStartElement("file");
+          xml.writeAttribute("name", report.file_name);
+          xml.writeAttribute("status", !report.error.isEmpty() ? "error"
+                                       : !report.issues.isEmpty() ? "invalid"
+                                       : "ok");
+
+          if (!report.error.isEmpty())
+            xml.writeTextElement("error", report.error);
+
+          foreach (const Issue &issue, report.issues)
+            {
+              xml.writeStartElement("issue");
+              xml.writeAttribute("path", issue.path);
+              xml.writeAttribute("value", issue.value);
+              xml.writeCharacters(issue.message);
+              xml.writeEndElement();
+            }
+
+          xml.writeEndElement();
+        }
+
+      xml.writeEndDocument();
+    }
+
+
+
+    QString ParameterLinter::error_string () const
+    {
+      return error;
+    }
+
+
+
+    void ParameterLinter::check (const QString &path,
+                                 const QString &value,
+                                 const QString &pattern_description,
+                                 const QDir    &directory,
+                                 FileReport    &report)
+    {
+      // the value has to be convertible to the type the parameterGUI stores it as
+      QString conversion_error;
+      XMLParameterReader::typed_value(value,
+                                      XMLParameterReader::value_type(pattern_description),
+                                      conversion_error);
+      if (!conversion_error.isEmpty())
+        {
+          add_issue(report, path, value,
+                    QObject::tr("The value can not be converted to the type of the parameter."));
+          return;
+        }
+
+      const ParameterPattern pattern = ParameterPattern::get(pattern_description);
+
+      if (!pattern.is_valid(value))
+        {
+          switch (pattern.kind)
+            {
+              case ParameterPattern::integer:
+                add_issue(report, path, value,
+                          QObject::tr("The value is not in the range %1...%2.")
+                          .arg(pattern.min_integer)
+                          .arg(pattern.max_integer));
+                break;
+
+              case ParameterPattern::floating_point:
+                add_issue(report, path, value,
+                          QObject::tr("The value is not in the range %1...%2.")
+                          .arg(pattern.min_double)
+                          .arg(pattern.max_double));
+                break;
+
+              case ParameterPattern::selection:
+                add_issue(report, path, value,
+                          QObject::tr("The value is not one of %1.")
+                          .arg(pattern.choices.join("|")));
+                break;
+
+              case ParameterPattern::multiple_selection:
+                add_issue(report, path, value,
+                          QObject::tr("The value contains choices that are not one of %1.")
+                          .arg(pattern.choices.join("|")));
+                break;
+
+              default:
+                add_issue(report, path, value,
+                          QObject::tr("The value does not satisfy the pattern %1.")
+                          .arg(pattern_description));
+                break;
+            }
+          return;
+        }
+
+      // files that are written by the program do not need to exist
+      if ((pattern.kind == ParameterPattern::file_name ||
+           pattern.kind == ParameterPattern::file_list ||
+           pattern.kind == ParameterPattern::directory_name) &&
+          !pattern_description.contains("Type: output"))
+        {
+          const QStringList names = (pattern.kind == ParameterPattern::file_list
+                                     ? value.split(pattern.list_separator)
+                                     : QStringList(value));
+
+          foreach (const QString &name, names)
+            {
+              if (name.trimmed().isEmpty())
+                continue;
+
+              const QFileInfo info(directory, name.trimmed());
+
+              if (pattern.kind == ParameterPattern::directory_name ? !info.isDir() : !info.exists())
+                add_issue(report, path, value,
+                          QObject::tr("%1 does not exist.").arg(name.trimmed()));
+            }
+        }
+    }
+  }
+}
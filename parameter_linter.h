@@ -0,0 +1,142 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERLINTER_H
+#define PARAMETERLINTER_H
+
+#include <QDir>
+#include <QHash>
+#include <QIODevice>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterLinter class checks many parameter files at once before they are
+     * used, e.g. for the runs of a campaign. For every parameter it checks that the
+     * value can be converted to the data type of the parameter, that it satisfies the
+     * bounds of numeric patterns and is one of the choices of a selection, and that
+     * the files and directories named by input &quot;FileName&quot; and
+     * &quot;DirectoryName&quot; parameters exist, relative to the directory of the file.
+     *
+     * Parameter files in XML format contain the patterns of their parameters. Files in
+     * PRM format only contain values, they are checked against a schema, an XML file
+     * with all parameters (see @ref set_schema). If a schema is given, parameters of
+     * XML files that are not in the schema are reported as well.
+     *
+     * Files are read with XMLParameterReader::read_parameters and converted with the
+     * functions of the @ref XMLParameterReader, but without building a tree, since
+     * widgets can only be created in the main thread. Instead the files
+     * are checked on a QThreadPool, each file by itself, so a file that can not be
+     * read does not stop the others from being checked.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterLinter
+    {
+    public:
+      /**
+       * A problem with the value of a parameter.
+       */
+      struct Issue
+      {
+        QString  path;
+        QString  value;
+        QString  message;
+      };
+
+      /**
+       * The result of checking a file. The <tt>error</tt> is set if the
+       * file could not be read, otherwise the <tt>issues</tt> are listed.
+       */
+      struct FileReport
+      {
+        QString          file_name;
+        QString          error;
+        QVector<Issue>   issues;
+      };
+
+      /**
+       * Read the patterns of the parameters from the parameter file
+       * in XML format @p device. Returns false if it can not be read.
+       */
+      bool set_schema (QIODevice *device);
+
+      /**
+       * Return the parameter files in @p paths and, recursively, in the
+       * directories among them, i.e. all files ending in <tt>.xml</tt> or <tt>.prm</tt>.
+       */
+      static QStringList parameter_files (const QStringList &paths);
+
+      /**
+       * Check the @p file_names in parallel and return a report for each of them.
+       */
+      QVector<FileReport> lint (const QStringList &file_names) const;
+
+      /**
+       * Check the file @p file_name. This function is thread-safe.
+       */
+      FileReport lint_file (const QString &file_name) const;
+
+      /**
+       * Write @p reports to @p device in XML format.
+       */
+      static void write_report (const QVector<FileReport> &reports,
+                                QIODevice                 *device);
+
+      /**
+       * This function returns an error message.
+       */
+      QString error_string () const;
+
+    private:
+      /**
+       * Check the @p value of the parameter @p path with @p pattern_description,
+       * in a file in @p directory, and add the problems to @p report.
+       */
+      static void check (const QString &path,
+                         const QString &value,
+                         const QString &pattern_description,
+                         const QDir    &directory,
+                         FileReport    &report);
+
+      /**
+       * The pattern descriptions of the parameters in the schema by their paths.
+       */
+      QHash<QString, QString> schema;
+
+      /**
+       * The message of the last error.
+       */
+      QString error;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,183 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_path_index.h"
+#include "parameter_item.h"
+
+#include <QPair>
+
+#include <algorithm>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // Return how well @p text matches @p pattern, which must be in lower case,
+      // or -1 if the characters of @p pattern do not all occur in @p text in the
+      // same order.
+      int fuzzy_score (const QString &pattern,
+                       const QString &text)
+      {
+        int score = 0;
+        int previous_match = -2;
+        int j = 0;
+
+        for (int i = 0; i < text.size() && j < pattern.size(); ++i)
+          if (text[i].toLower() == pattern[j])
+            {
+              score += 1;
+
+              // consecutive characters
+              if (i == previous_match + 1)
+                score += 5;
+
+              // characters at the beginning of a name or word
+              if (i == 0 || !text[i-1].isLetterOrNumber())
+                score += 10;
+
+              previous_match = i;
+              ++j;
+            }
+
+        if (j < pattern.size())
+          return -1;
+
+        // prefer shorter paths among equally good matches
+        return 1000 * score - text.size();
+      }
+
+
+
+      // Sort matches by decreasing score and increasing id.
+      bool better_match (const QPair<int, int> &match_1,
+                         const QPair<int, int> &match_2)
+      {
+        if (match_1.first != match_2.first)
+          return match_1.first > match_2.first;
+        else
+          return match_1.second < match_2.second;
+      }
+    }
+
+
+
+    void ParameterPathIndex::build(QTreeWidget *tree_widget)
+    {
+      clear();
+
+      for (int i = 0; i < tree_widget->topLevelItemCount(); ++i)
+        insert(tree_widget->topLevelItem(i));
+    }
+
+
+
+    void ParameterPathIndex::clear()
+    {
+      ids_by_path.clear();
+      ids_by_item.clear();
+      items.clear();
+      paths.clear();
+    }
+
+
+
+    void ParameterPathIndex::insert(QTreeWidgetItem *item)
+    {
+      const QString item_path = ParameterItem::path(item);
+      const int item_id = items.size();
+
+      ids_by_path.insert(item_path, item_id);
+      ids_by_item.insert(item, item_id);
+      items.append(item);
+      paths.append(item_path);
+
+      for (int i = 0; i < item->childCount(); ++i)
+        insert(item->child(i));
+    }
+
+
+
+    int ParameterPathIndex::size() const
+    {
+      return items.size();
+    }
+
+
+
+    int ParameterPathIndex::id(const QString &path) const
+    {
+      return ids_by_path.value(path, -1);
+    }
+
+
+
+    int ParameterPathIndex::id(const QTreeWidgetItem *item) const
+    {
+      return ids_by_item.value(item, -1);
+    }
+
+
+
+    QTreeWidgetItem *ParameterPathIndex::item(const int id) const
+    {
+      return items.value(id, 0);
+    }
+
+
+
+    QTreeWidgetItem *ParameterPathIndex::item(const QString &path) const
+    {
+      return item(id(path));
+    }
+
+
+
+    QString ParameterPathIndex::path(const int id) const
+    {
+      return paths.value(id);
+    }
+
+
+
+    QVector<int> ParameterPathIndex::fuzzy_matches(const QString &pattern,
+                                                   const int      max_results) const
+    {
+      const QString lower_case_pattern = pattern.toLower();
+
+      // pairs of score and id
+      QVector<QPair<int, int> > matches;
+
+      for (int i = 0; i < paths.size(); ++i)
+        {
+          const int score = fuzzy_score(lower_case_pattern, paths[i]);
+          if (score >= 0)
+            matches.append(qMakePair(score, i));
+        }
+
+      // we only need the best matches in order
+      const int n_results = qMin(max_results, matches.size());
+      std::partial_sort(matches.begin(), matches.begin() + n_results, matches.end(), better_match);
+
+      QVector<int> result(n_results);
+      for (int i = 0; i < n_results; ++i)
+        result[i] = matches[i].second;
+
+      return result;
+    }
+  }
+}
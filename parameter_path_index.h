@@ -0,0 +1,135 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERPATHINDEX_H
+#define PARAMETERPATHINDEX_H
+
+#include <QHash>
+#include <QString>
+#include <QTreeWidget>
+#include <QTreeWidgetItem>
+#include <QVector>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterPathIndex class assigns ids to the items of a parameter tree and
+     * allows to find items by their path, e.g. <tt>Section/Subsection/Parameter</tt>
+     * (see ParameterItem::path()), or their id in constant time instead of walking
+     * the children of the tree. Ids are positions in the order the items were inserted
+     * and stay valid until the index is rebuilt, so they can be used to refer to
+     * parameters in other data structures. The parameterGUI never adds or removes
+     * parameters of a loaded file, so the index is built once after every load.
+     *
+     * Names of subsections and parameters may contain &quot;/&quot; themselves, in
+     * which case their paths are ambiguous. The index then returns the item inserted last.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterPathIndex
+    {
+    public:
+      /**
+       * Rebuild the index for all items of @p tree_widget.
+       */
+      void build (QTreeWidget *tree_widget);
+
+      /**
+       * Remove all items from the index.
+       */
+      void clear ();
+
+      /**
+       * Return the number of ids assigned so far.
+       */
+      int size () const;
+
+      /**
+       * Return the id of the item with @p path, or -1 if there is no such item.
+       */
+      int id (const QString &path) const;
+
+      /**
+       * Return the id of @p item, or -1 if it is not in the index.
+       */
+      int id (const QTreeWidgetItem *item) const;
+
+      /**
+       * Return the item with @p id, or 0 if there is no such item.
+       */
+      QTreeWidgetItem *item (const int id) const;
+
+      /**
+       * Return the item with @p path, or 0 if there is no such item.
+       */
+      QTreeWidgetItem *item (const QString &path) const;
+
+      /**
+       * Return the path of the item with @p id.
+       */
+      QString path (const int id) const;
+
+      /**
+       * Return the ids of the items whose paths contain the characters of @p pattern
+       * in the same order, ignoring case. The ids are sorted by how well the path matches:
+       * consecutive characters and characters at the beginning of names or words
+       * rank higher, and shorter paths rank higher than longer ones. At most
+       * @p max_results ids are returned.
+       */
+      QVector<int> fuzzy_matches (const QString &pattern,
+                                  const int      max_results) const;
+
+    private:
+      /**
+       * Add @p item and all of its children to the index.
+       */
+      void insert (QTreeWidgetItem *item);
+
+      /**
+       * The ids by path.
+       */
+      QHash<QString, int> ids_by_path;
+
+      /**
+       * The ids by item.
+       */
+      QHash<const QTreeWidgetItem *, int> ids_by_item;
+
+      /**
+       * The items by id.
+       */
+      QVector<QTreeWidgetItem *> items;
+
+      /**
+       * The paths by id.
+       */
+      QVector<QString> paths;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,496 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_pattern.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QRegExp>
+#include <QVariant>
+
+#include <algorithm>
+#include <limits>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // Return the position of the '>' that closes the '<' at position
+      // @p open in @p s, or -1 if the brackets are not balanced.
+      int closing_bracket (const QString &s,
+                           const int      open)
+      {
+        int depth = 0;
+
+        for (int i=open; i<s.size(); ++i)
+          if (s[i] == QLatin1Char('<'))
+            ++depth;
+          else if (s[i] == QLatin1Char('>'))
+            {
+              --depth;
+              if (depth == 0)
+                return i;
+            }
+
+        return -1;
+      }
+
+
+
+      // Return the kind of a pattern whose description is understood by
+      // @p validator, which follows from the outermost pattern.
+      ParameterPattern::Kind kind_of (const PatternValidator &validator)
+      {
+        switch (validator.kind())
+          {
+            case PatternValidator::list:
+              return (validator.element_kind() == PatternValidator::file_name
+                      ? ParameterPattern::file_list
+                      : ParameterPattern::list);
+
+            case PatternValidator::map:
+              return ParameterPattern::map;
+
+            case PatternValidator::file_name:
+              return ParameterPattern::file_name;
+
+            case PatternValidator::directory_name:
+              return ParameterPattern::directory_name;
+
+            case PatternValidator::integer:
+              return ParameterPattern::integer;
+
+            case PatternValidator::floating_point:
+              return ParameterPattern::floating_point;
+
+            case PatternValidator::selection:
+              return ParameterPattern::selection;
+
+            case PatternValidator::multiple_selection:
+              return ParameterPattern::multiple_selection;
+
+            case PatternValidator::boolean:
+              return ParameterPattern::boolean;
+
+            case PatternValidator::anything:
+            case PatternValidator::tuple:
+              return ParameterPattern::anything;
+
+            default:
+              return ParameterPattern::unknown;
+          }
+      }
+
+
+
+      // Orders positions in a list of choices by the choices ignoring case,
+      // and equal choices by their positions.
+      struct ChoiceOrder
+      {
+        ChoiceOrder (const QStringList &choices)
+          : choices(choices)
+        {
+        }
+
+        bool operator() (const int a, const int b) const
+        {
+          const int c = choices[a].compare(choices[b], Qt::CaseInsensitive);
+          return (c < 0) || (c == 0 && a < b);
+        }
+
+        const QStringList &choices;
+      };
+    }
+
+
+
+    ParameterPattern::ParameterPattern ()
+                    : kind(unknown),
+                      min_integer(std::numeric_limits<int>::min()),
+                      max_integer(std::numeric_limits<int>::max()),
+                      min_double(-std::numeric_limits<double>::max()/2),
+                      max_double(std::numeric_limits<double>::max()/2),
+                      list_separator(","),
+                      key_value_separator(":")
+    {
+    }
+
+
+
+    ParameterPattern::ParameterPattern (const QString &pattern_description)
+                    : kind(unknown),
+                      min_integer(std::numeric_limits<int>::min()),
+                      max_integer(std::numeric_limits<int>::max()),
+                      min_double(-std::numeric_limits<double>::max()/2),
+                      max_double(std::numeric_limits<double>::max()/2),
+                      list_separator(","),
+                      key_value_separator(":")
+    {
+      validator = PatternValidator::get(pattern_description);
+
+      // descriptions the validator understands are classified by their
+      // outermost pattern, e.g. a "Tuple" of "Integer"s is edited as text,
+      // and everything else is taken from it as well
+      if (validator.kind() != PatternValidator::unknown)
+        {
+          kind = kind_of(validator);
+
+          // bounds of unsigned patterns may exceed the range of int
+          min_integer = static_cast<int>(qBound<qint64>(std::numeric_limits<int>::min(),
+                                                        validator.min_integer(),
+                                                        std::numeric_limits<int>::max()));
+          max_integer = static_cast<int>(qBound<qint64>(std::numeric_limits<int>::min(),
+                                                        validator.max_integer(),
+                                                        std::numeric_limits<int>::max()));
+
+          // stay below MAX_DOUBLE, see parse_keywords()
+          min_double = qMax(validator.min_double(), min_double);
+          max_double = qMin(validator.max_double(), max_double);
+
+          choices = validator.choices();
+
+          if (kind == list || kind == file_list || kind == map)
+            {
+              list_separator = validator.separator();
+              key_value_separator = validator.key_value_separator();
+              element_description = validator.element_description();
+              value_description = validator.value_description();
+            }
+        }
+      else
+        parse_keywords(pattern_description);
+
+      // index the choices, there may be thousands of them
+      sorted_choices.resize(choices.size());
+      for (int i=0; i<choices.size(); ++i)
+        {
+          sorted_choices[i] = i;
+          if (!choice_positions.contains(choices[i]))
+            choice_positions.insert(choices[i], i);
+        }
+      std::sort(sorted_choices.begin(), sorted_choices.end(), ChoiceOrder(choices));
+    }
+
+
+
+    void ParameterPattern::parse_keywords (const QString &pattern_description)
+    {
+      QRegExp  rx_string("\\b(Anything|MultipleSelection|Map)\\b"),
+               rx_map("\\b(Map)\\b"),
+               rx_list("\\b(List)\\b"),
+               rx_filename("\\b(FileName)\\b"),
+               rx_dirname("\\b(DirectoryName)\\b"),
+               rx_integer("\\b(Integer)\\b"),
+               rx_double("\\b(Double|Float|Floating)\\b"),
+               rx_selection("\\b(Selection)\\b"),
+               rx_bool("\\b(Bool)\\b");
+
+      // classify the description by the keywords it contains
+      if (rx_string.indexIn (pattern_description) != -1)
+        {
+          if (pattern_description.trimmed().startsWith("[Map"))
+            kind = map;
+          else if (pattern_description.trimmed().startsWith("[MultipleSelection"))
+            kind = multiple_selection;
+          else
+            kind = anything;
+        }
+      else if (rx_list.indexIn (pattern_description) != -1)
+        {
+          if (rx_filename.indexIn (pattern_description) != -1)
+            kind = file_list;
+          else
+            kind = list;
+        }
+      else if (rx_filename.indexIn (pattern_description) != -1)
+        kind = file_name;
+      else if (rx_dirname.indexIn (pattern_description) != -1)
+        kind = directory_name;
+      else if (rx_integer.indexIn (pattern_description) != -1)
+        kind = integer;
+      else if (rx_double.indexIn (pattern_description) != -1)
+        kind = floating_point;
+      else if (rx_selection.indexIn (pattern_description) != -1)
+        kind = selection;
+      else if (rx_bool.indexIn (pattern_description) != -1)
+        kind = boolean;
+
+      // numeric patterns are of the form "[Integer range 0...10 (inclusive)]"
+      // or "[Double -MAX_DOUBLE...MAX_DOUBLE (inclusive)]"
+      if (kind == integer || kind == floating_point)
+        {
+          const QStringList default_pattern = pattern_description.split(" ").filter("...");
+
+          if (!default_pattern.isEmpty())
+            {
+              QStringList default_values = default_pattern[0].split("...");
+
+              if (default_values.size() == 2)
+                {
+                  if (kind == integer)
+                    {
+                      // bounds of unsigned patterns may exceed the range of int,
+                      // clamp them instead of letting the conversion fail
+                      bool ok = true;
+                      const qlonglong min_value = default_values[0].toLongLong(&ok);
+                      if (ok)
+                        min_integer = static_cast<int>(qBound<qlonglong>(std::numeric_limits<int>::min(),
+                                                                         min_value,
+                                                                         std::numeric_limits<int>::max()));
+
+                      const qlonglong max_value = default_values[1].toLongLong(&ok);
+                      if (ok)
+                        max_integer = static_cast<int>(qBound<qlonglong>(std::numeric_limits<int>::min(),
+                                                                         max_value,
+                                                                         std::numeric_limits<int>::max()));
+                    }
+                  else
+                    {
+                      // Unfortunately conversion of MAX_DOUBLE to string and back fails
+                      // sometimes, therefore use MAX_DOUBLE/2 to make sure we are below.
+                      // In practice MAX_DOUBLE just means VERY large, it is normally not
+                      // important how large.
+                      const double max = std::numeric_limits<double>::max()/2;
+                      default_values = default_values.replaceInStrings("MAX_DOUBLE",
+                                                                       QVariant(max).toString());
+
+                      min_double = default_values[0].toDouble();
+                      max_double = default_values[1].toDouble();
+                    }
+                }
+            }
+        }
+
+      // we assume, that a selection is of the form
+      // "[Selection item1|item2| ....|item ]", and the same for a
+      // "MultipleSelection". Find the first space after the first '[',
+      // which indicates the start of the first option
+      if (kind == selection || kind == multiple_selection)
+        {
+          int begin_pattern = pattern_description.indexOf("[");
+          begin_pattern = pattern_description.indexOf(" ",begin_pattern) + 1;
+
+          // Find the last ']', which signals the end of the options
+          const int end_pattern = pattern_description.lastIndexOf("]");
+
+          // Extract the options from the string
+          QString pattern = pattern_description.mid(begin_pattern,end_pattern-begin_pattern);
+
+          // Remove trailing whitespaces
+          while (pattern.endsWith(' '))
+            pattern.chop(1);
+
+          // Split the list
+          choices = pattern.split("|");
+        }
+
+      // lists and maps are of the form
+      // "[List of <[...]> of length 0...10 (inclusive) separated by <;>]" or
+      // "[Map of <[...]>:<[...]> of length 0...10 (inclusive) separated by <;>]",
+      // where the separator is only given if it is not the default ",".
+      // The element patterns may themselves be lists, so we skip them by
+      // matching brackets before we look for the separators.
+      const bool is_map = (rx_map.indexIn (pattern_description) != -1);
+      if (kind == list || kind == file_list || is_map)
+        {
+          const int element_begin = pattern_description.indexOf("of <");
+
+          if (element_begin != -1)
+            {
+              int element_end = closing_bracket(pattern_description, element_begin+3);
+
+              if (element_end != -1)
+                element_description = pattern_description.mid(element_begin+4,
+                                                               element_end-element_begin-4);
+
+              // the key/value separator of a map is printed between
+              // the key and the value pattern
+              if (is_map && element_end != -1)
+                {
+                  const int value_begin = pattern_description.indexOf('<', element_end);
+
+                  if (value_begin != -1)
+                    {
+                      key_value_separator = pattern_description.mid(element_end+1,
+                                                                    value_begin-element_end-1);
+                      element_end = closing_bracket(pattern_description, value_begin);
+
+                      if (element_end != -1)
+                        value_description = pattern_description.mid(value_begin+1,
+                                                                     element_end-value_begin-1);
+                    }
+                }
+
+              if (element_end != -1)
+                {
+                  const QString separated_by = "separated by <";
+                  const int separator_begin = pattern_description.indexOf(separated_by, element_end);
+
+                  if (separator_begin != -1)
+                    {
+                      const int begin = separator_begin + separated_by.size();
+                      const int end = pattern_description.indexOf('>', begin+1);
+
+                      if (end != -1)
+                        list_separator = pattern_description.mid(begin, end-begin);
+                    }
+                }
+            }
+        }
+    }
+
+
+
+    bool ParameterPattern::is_valid (const QString &value) const
+    {
+      if (validator.kind() != PatternValidator::unknown)
+        return validator.validate(value);
+
+      switch (kind)
+        {
+          case integer:
+            {
+              bool ok = true;
+              const int number = value.trimmed().toInt(&ok);
+              return ok && (number >= min_integer) && (number <= max_integer);
+            }
+
+          case floating_point:
+            {
+              bool ok = true;
+              const double number = value.trimmed().toDouble(&ok);
+              return ok && (number >= min_double) && (number <= max_double);
+            }
+
+          case selection:
+            return choice_positions.contains(value.trimmed());
+
+          case multiple_selection:
+            {
+              bool ok = true;
+              selected_choices(value, &ok);
+              return ok;
+            }
+
+          case boolean:
+            return (value == "true") || (value == "false");
+
+          default:
+            return true;
+        }
+    }
+
+
+
+    QBitArray ParameterPattern::selected_choices (const QString &value,
+                                                  bool          *ok) const
+    {
+      QBitArray selected(choices.size());
+      bool all_choices = true;
+
+      foreach (const QString &part, value.split(','))
+        {
+          const QString choice = part.trimmed();
+          if (choice.isEmpty())
+            continue;
+
+          const int position = choice_positions.value(choice, -1);
+          if (position != -1)
+            selected.setBit(position);
+          else
+            all_choices = false;
+        }
+
+      if (ok)
+        *ok = all_choices;
+
+      return selected;
+    }
+
+
+
+    QString ParameterPattern::selection_value (const QBitArray &selected) const
+    {
+      QString value;
+
+      for (int i=0; i<selected.size() && i<choices.size(); ++i)
+        if (selected.testBit(i))
+          {
+            if (!value.isEmpty())
+              value += ", ";
+            value += choices[i];
+          }
+
+      return value;
+    }
+
+
+
+    void ParameterPattern::find_choices (const QString &prefix,
+                                         int           &begin,
+                                         int           &end) const
+    {
+      // the choices beginning with the prefix follow each other in the
+      // sorted list, starting at the first one that is not less than it
+      int low = 0,
+          high = sorted_choices.size();
+      while (low < high)
+        {
+          const int middle = (low + high) / 2;
+          if (choices[sorted_choices[middle]].compare(prefix, Qt::CaseInsensitive) < 0)
+            low = middle + 1;
+          else
+            high = middle;
+        }
+      begin = low;
+
+      high = sorted_choices.size();
+      while (low < high)
+        {
+          const int middle = (low + high) / 2;
+          if (choices[sorted_choices[middle]].leftRef(prefix.size()).compare(prefix, Qt::CaseInsensitive) <= 0)
+            low = middle + 1;
+          else
+            high = middle;
+        }
+      end = low;
+    }
+
+
+
+    ParameterPattern ParameterPattern::get (const QString &pattern_description)
+    {
+      // the patterns of all parameters ever loaded; the number of distinct
+      // descriptions is small compared to the number of parameters
+      static QHash<QString, ParameterPattern> patterns;
+
+      // files may be converted in several threads at once
+      static QMutex mutex;
+      QMutexLocker lock(&mutex);
+
+      QHash<QString, ParameterPattern>::const_iterator
+        p = patterns.constFind(pattern_description);
+
+      if (p == patterns.constEnd())
+        p = patterns.insert(pattern_description, ParameterPattern(pattern_description));
+
+      return p.value();
+    }
+  }
+}
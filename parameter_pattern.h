@@ -0,0 +1,186 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERPATTERN_H
+#define PARAMETERPATTERN_H
+
+#include <QBitArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "pattern_validator.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterPattern class stores the information the parameterGUI extracts from
+     * the <tt>pattern_description</tt> of a parameter: the kind of the pattern, the bounds
+     * of &quot;Integer&quot; and &quot;Double&quot; patterns, the choices of &quot;Selection&quot;
+     * patterns and the separators of &quot;List&quot; and &quot;Map&quot; patterns.
+     * All of these are taken from the outermost pattern of the @ref PatternValidator
+     * compiled from the description. Only descriptions the validator does not understand
+     * are parsed with regular expressions and string splitting. Both are comparatively
+     * expensive. Therefore objects of this class should be obtained by
+     * @ref get, which parses every distinct description only once and returns a copy
+     * of the cached object afterwards. Copies are cheap, since the list of choices is
+     * implicitly shared.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterPattern
+    {
+    public:
+      /**
+       * The kinds of patterns the parameterGUI provides special editors for.
+       * The kind is determined with the same precedence the @ref ParameterDelegate
+       * has always used, e.g. a &quot;List&quot; of &quot;FileName&quot;s is a
+       * <tt>file_list</tt> and not a <tt>file_name</tt>. A &quot;Map&quot; or a
+       * &quot;MultipleSelection&quot; is only of kind <tt>map</tt> or
+       * <tt>multiple_selection</tt> if it is not nested in another pattern.
+       */
+      enum Kind {anything = 0, list, map, file_list, file_name, directory_name,
+                 integer, floating_point, selection, multiple_selection, boolean, unknown};
+
+      /**
+       * Constructor. Creates a pattern of kind <tt>unknown</tt>.
+       */
+      ParameterPattern ();
+
+      /**
+       * Return the pattern for @p pattern_description. The description is
+       * parsed the first time it is requested, later calls only look it up.
+       * This function is thread-safe.
+       */
+      static ParameterPattern get (const QString &pattern_description);
+
+      /**
+       * Return whether @p value satisfies this pattern. If the description is understood
+       * by the <tt>validator</tt>, the value is checked completely, including the elements
+       * of lists, maps and tuples. Otherwise only the bounds of numeric patterns and the
+       * choices of selections and booleans are checked.
+       */
+      bool is_valid (const QString &value) const;
+
+      /**
+       * Return which choices of a &quot;MultipleSelection&quot; pattern the comma
+       * separated @p value selects, as a bit for each choice. If @p ok is given, it is
+       * set to whether all parts of @p value are choices. Every part is looked up in
+       * <tt>choice_positions</tt>, so this takes a time proportional to the length of
+       * @p value, independently of the number of choices.
+       */
+      QBitArray selected_choices (const QString &value,
+                                  bool          *ok = 0) const;
+
+      /**
+       * Return the value of a &quot;MultipleSelection&quot; parameter that selects
+       * the choices whose bits are set in @p selected, in the order of the choices.
+       */
+      QString selection_value (const QBitArray &selected) const;
+
+      /**
+       * Find the choices of a &quot;Selection&quot; pattern that begin with @p prefix,
+       * ignoring case. These are the choices <tt>choices[sorted_choices[i]]</tt> for
+       * @p begin <= i < @p end. This is a binary search in <tt>sorted_choices</tt>.
+       */
+      void find_choices (const QString &prefix,
+                         int           &begin,
+                         int           &end) const;
+
+      /**
+       * The kind of the pattern.
+       */
+      Kind  kind;
+
+      /**
+       * The validator compiled from the description.
+       */
+      PatternValidator  validator;
+
+      /**
+       * The bounds of an &quot;Integer&quot; pattern.
+       */
+      int  min_integer, max_integer;
+
+      /**
+       * The bounds of a &quot;Double&quot; pattern.
+       */
+      double  min_double, max_double;
+
+      /**
+       * The choices of a &quot;Selection&quot; or &quot;MultipleSelection&quot; pattern.
+       */
+      QStringList  choices;
+
+      /**
+       * The positions of the <tt>choices</tt>, sorted by the choices ignoring case.
+       */
+      QVector<int>  sorted_choices;
+
+      /**
+       * The first position of every choice in <tt>choices</tt>.
+       */
+      QHash<QString, int>  choice_positions;
+
+      /**
+       * The separator between the elements of a &quot;List&quot; or &quot;Map&quot; pattern.
+       */
+      QString  list_separator;
+
+      /**
+       * The separator between keys and values of a &quot;Map&quot; pattern.
+       */
+      QString  key_value_separator;
+
+      /**
+       * The description of the pattern of the elements of a &quot;List&quot;
+       * or of the keys of a &quot;Map&quot;, e.g. &quot;[Integer]&quot;.
+       */
+      QString  element_description;
+
+      /**
+       * The description of the pattern of the values of a &quot;Map&quot;.
+       */
+      QString  value_description;
+
+    private:
+      /**
+       * Constructor. Parse @p pattern_description.
+       */
+      ParameterPattern (const QString &pattern_description);
+
+      /**
+       * Fill the pattern from the keywords in @p pattern_description, for
+       * descriptions the <tt>validator</tt> does not understand.
+       */
+      void parse_keywords (const QString &pattern_description);
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,234 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_search_index.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // Query words shorter than this only match whole words.
+      const int min_prefix_length = 3;
+
+
+
+      // Add @p id to the postings of all words in @p words. Ids are added in
+      // increasing order while building, so appending keeps the lists sorted
+      // in this case.
+      void add_postings (QMap<QString, QVector<int> > &postings,
+                         const QStringList            &words,
+                         const int                     id)
+      {
+        for (int i = 0; i < words.size(); ++i)
+          {
+            QVector<int> &ids = postings[words[i]];
+
+            if (ids.isEmpty() || ids.last() < id)
+              ids.append(id);
+            else
+              {
+                QVector<int>::iterator p = std::lower_bound(ids.begin(), ids.end(), id);
+                if (*p != id)
+                  ids.insert(p, id);
+              }
+          }
+      }
+
+
+
+      // Remove @p id from the postings of all words in @p words.
+      void remove_postings (QMap<QString, QVector<int> > &postings,
+                            const QStringList            &words,
+                            const int                     id)
+      {
+        for (int i = 0; i < words.size(); ++i)
+          {
+            QMap<QString, QVector<int> >::iterator w = postings.find(words[i]);
+            if (w == postings.end())
+              continue;
+
+            QVector<int> &ids = w.value();
+            QVector<int>::iterator p = std::lower_bound(ids.begin(), ids.end(), id);
+            if (p != ids.end() && *p == id)
+              ids.erase(p);
+
+            if (ids.isEmpty())
+              postings.erase(w);
+          }
+      }
+
+
+
+      // Collect the postings of all words starting with @p prefix.
+      void collect_postings (const QMap<QString, QVector<int> > &postings,
+                             const QString                      &prefix,
+                             QVector<int>                       &ids)
+      {
+        for (QMap<QString, QVector<int> >::const_iterator w = postings.lowerBound(prefix);
+             w != postings.constEnd() && w.key().startsWith(prefix);
+             ++w)
+          ids += w.value();
+      }
+    }
+
+
+
+    void ParameterSearchIndex::build(const QVector<Entry> &entries)
+    {
+      text_postings.clear();
+      value_postings.clear();
+      values.resize(entries.size());
+
+      for (int id = 0; id < entries.size(); ++id)
+        {
+          add_postings(text_postings, words(entries[id].path), id);
+          add_postings(text_postings, words(entries[id].documentation), id);
+          add_postings(value_postings, words(entries[id].value), id);
+
+          values[id] = entries[id].value;
+        }
+    }
+
+
+
+    void ParameterSearchIndex::update_value(const int      id,
+                                            const QString &value)
+    {
+      if (id < 0 || id >= values.size())
+        return;
+
+      remove_postings(value_postings, words(values[id]), id);
+      add_postings(value_postings, words(value), id);
+
+      values[id] = value;
+    }
+
+
+
+    QVector<int> ParameterSearchIndex::search(const QString &query,
+                                              const int      max_results) const
+    {
+      const QStringList query_words = words(query);
+
+      QVector<int> result;
+
+      for (int w = 0; w < query_words.size(); ++w)
+        {
+          const QVector<int> matches = prefix_matches(query_words[w]);
+
+          if (w == 0)
+            result = matches;
+          else
+            {
+              QVector<int> intersection;
+              std::set_intersection(result.constBegin(), result.constEnd(),
+                                    matches.constBegin(), matches.constEnd(),
+                                    std::back_inserter(intersection));
+              result = intersection;
+            }
+
+          if (result.isEmpty())
+            break;
+        }
+
+      if (result.size() > max_results)
+        result.resize(max_results);
+
+      return result;
+    }
+
+
+
+    QVector<int> ParameterSearchIndex::prefix_matches(const QString &prefix) const
+    {
+      // short prefixes begin thousands of words in large files
+      if (prefix.size() < min_prefix_length)
+        {
+          QVector<int> ids = text_postings.value(prefix);
+          const QVector<int> value_ids = value_postings.value(prefix);
+
+          if (value_ids.isEmpty())
+            return ids;
+
+          QVector<int> merged;
+          std::set_union(ids.constBegin(), ids.constEnd(),
+                         value_ids.constBegin(), value_ids.constEnd(),
+                         std::back_inserter(merged));
+          return merged;
+        }
+
+      QVector<int> ids;
+
+      collect_postings(text_postings, prefix, ids);
+      collect_postings(value_postings, prefix, ids);
+
+      std::sort(ids.begin(), ids.end());
+      ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+      return ids;
+    }
+
+
+
+    QStringList ParameterSearchIndex::words(const QString &text)
+    {
+      QStringList result;
+
+      int begin = -1;
+      for (int i = 0; i <= text.size(); ++i)
+        {
+          const bool is_word_character = (i < text.size()) && text[i].isLetterOrNumber();
+
+          if (is_word_character && begin == -1)
+            begin = i;
+          else if (!is_word_character && begin != -1)
+            {
+              result.append(text.mid(begin, i-begin).toLower());
+              begin = -1;
+            }
+        }
+
+      // a word occurring several times needs to be indexed only once
+      result.removeDuplicates();
+
+      return result;
+    }
+
+
+
+    SearchIndexBuilder::SearchIndexBuilder(const QVector<ParameterSearchIndex::Entry> &entries,
+                                           QObject *parent)
+                      : QThread(parent),
+                        entries(entries)
+    {
+    }
+
+
+
+    void SearchIndexBuilder::run()
+    {
+      index.build(entries);
+
+      // the entries are not needed anymore
+      entries.clear();
+    }
+  }
+}
@@ -0,0 +1,160 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERSEARCHINDEX_H
+#define PARAMETERSEARCHINDEX_H
+
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+#include <QVector>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterSearchIndex class implements a full-text search over the paths,
+     * values and documentation of parameters. The texts are split into lower case
+     * words and for every word the index stores the sorted list of the parameters
+     * it occurs in. A query is split the same way, and a parameter matches if every
+     * word of the query is the beginning of a word of the parameter, so that results
+     * can be shown while the user types. Query words shorter than three characters
+     * only match whole words: they are the beginning of too many words, and merging
+     * the lists of all of these would take too long to do on every key press.
+     *
+     * Parameters are identified by their position in the list of entries the index
+     * was built from. The paths and documentation of parameters do not change after
+     * a file was loaded, the words of their values are stored separately so that
+     * they can be updated when a value is edited.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterSearchIndex
+    {
+    public:
+      /**
+       * The texts of a parameter the index is built from.
+       */
+      struct Entry
+      {
+        QString  path;
+        QString  value;
+        QString  documentation;
+      };
+
+      /**
+       * Build the index for @p entries. This may take a while
+       * for large files, see @ref SearchIndexBuilder.
+       */
+      void build (const QVector<Entry> &entries);
+
+      /**
+       * Replace the value of the parameter @p id by @p value.
+       */
+      void update_value (const int      id,
+                         const QString &value);
+
+      /**
+       * Return the parameters matching @p query, at most @p max_results of them,
+       * in the order of the entries the index was built from.
+       */
+      QVector<int> search (const QString &query,
+                           const int      max_results) const;
+
+      /**
+       * Split @p text into lower case words consisting of letters and digits.
+       */
+      static QStringList words (const QString &text);
+
+    private:
+      /**
+       * Return the sorted list of parameters that contain a word starting with @p prefix,
+       * or only the word @p prefix itself if it is shorter than three characters.
+       */
+      QVector<int> prefix_matches (const QString &prefix) const;
+
+      /**
+       * For every word in the paths and documentation of the parameters,
+       * the sorted list of parameters it occurs in.
+       */
+      QMap<QString, QVector<int> > text_postings;
+
+      /**
+       * For every word in the values of the parameters,
+       * the sorted list of parameters it occurs in.
+       */
+      QMap<QString, QVector<int> > value_postings;
+
+      /**
+       * The indexed values of the parameters, needed to remove
+       * their words when a value is updated.
+       */
+      QVector<QString> values;
+    };
+
+
+
+    /**
+     * The SearchIndexBuilder class builds a @ref ParameterSearchIndex in a separate thread,
+     * so that the GUI can be used while the index of a large file is built. The entries
+     * are copies of the texts of the parameters, which are implicitly shared with the
+     * items of the tree, so taking them is cheap and they can be read in the thread
+     * while the tree is edited. When the inherited <tt>finished()</tt> signal is emitted,
+     * <tt>index</tt> holds the result.
+     *
+     * @ingroup ParameterGui
+     */
+    class SearchIndexBuilder : public QThread
+    {
+    public:
+      /**
+       * Constructor. The index will be built for @p entries.
+       */
+      SearchIndexBuilder (const QVector<ParameterSearchIndex::Entry> &entries,
+                          QObject *parent = 0);
+
+      /**
+       * The index, valid after the thread has finished.
+       */
+      ParameterSearchIndex  index;
+
+    protected:
+      /**
+       * Reimplemented from QThread. Builds the index.
+       */
+      void run ();
+
+    private:
+      /**
+       * The texts of the parameters.
+       */
+      QVector<ParameterSearchIndex::Entry>  entries;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
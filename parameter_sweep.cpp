@@ -0,0 +1,473 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_sweep.h"
+#include "xml_parameter_override.h"
+#include "xml_to_prm_converter.h"
+
+#include <QBuffer>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QRegExp>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+
+#include <cmath>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // The marker written in place of the value of the swept parameter @p i.
+      QString marker (const int i)
+      {
+        return QString("@@parameter_sweep_%1@@").arg(i);
+      }
+
+
+
+      // Escape the characters that can not appear in the text of an XML element.
+      QString xml_escaped (const QString &s)
+      {
+        QString escaped = s;
+        escaped.replace('&', "&amp;");
+        escaped.replace('<', "&lt;");
+        escaped.replace('>', "&gt;");
+        return escaped;
+      }
+
+
+
+      // Quote a field of a CSV file if needed.
+      QString csv_field (const QString &s)
+      {
+        if (!s.contains(',') && !s.contains('"') && !s.contains('\n'))
+          return s;
+
+        QString quoted = s;
+        quoted.replace('"', "\"\"");
+        return '"' + quoted + '"';
+      }
+
+
+
+      // The parameter file split at the markers: the value of the parameter
+      // parameters[i] has to be written between pieces[i] and pieces[i+1].
+      struct SweepTemplate
+      {
+        QList<QByteArray>            pieces;
+        QVector<int>                 parameters;
+        QVector<QVector<QByteArray> > values;
+      };
+
+
+
+      // Writes every step-th of the files, beginning with the first one.
+      class SweepWriter : public QRunnable
+      {
+      public:
+        SweepWriter (const SweepTemplate            &sweep_template,
+                     const QVector<QVector<int> >   &combinations,
+                     const QStringList              &file_names,
+                     const int                       first,
+                     const int                       step)
+          : sweep_template(sweep_template),
+            combinations(combinations),
+            file_names(file_names),
+            first(first),
+            step(step)
+        {
+          setAutoDelete(false);
+        }
+
+        void run ()
+        {
+          for (int i = first; i < combinations.size(); i += step)
+            {
+              QFile file(file_names[i]);
+
+              if (!file.open(QFile::WriteOnly))
+                {
+                  error = QObject::tr("Cannot write file %1:\n%2.")
+                          .arg(file_names[i])
+                          .arg(file.errorString());
+                  return;
+                }
+
+              const QVector<int> &combination = combinations[i];
+
+              for (int j = 0; j < sweep_template.parameters.size(); ++j)
+                {
+                  const int parameter = sweep_template.parameters[j];
+
+                  file.write(sweep_template.pieces[j]);
+                  file.write(sweep_template.values[parameter][combination[parameter]]);
+                }
+              file.write(sweep_template.pieces.last());
+
+              if (file.error() != QFile::NoError)
+                {
+                  error = QObject::tr("Cannot write file %1:\n%2.")
+                          .arg(file_names[i])
+                          .arg(file.errorString());
+                  return;
+                }
+            }
+        }
+
+        QString error;
+
+      private:
+        const SweepTemplate          &sweep_template;
+        const QVector<QVector<int> > &combinations;
+        const QStringList            &file_names;
+        const int                     first;
+        const int                     step;
+      };
+    }
+
+
+
+    QStringList ParameterSweep::parse_values (const QString &text)
+    {
+      // a range "first:step:last", all other texts are lists separated by ";"
+      QRegExp range("\\s*([^:\\s]+)\\s*:\\s*([^:\\s]+)\\s*:\\s*([^:\\s]+)\\s*");
+
+      if (range.exactMatch(text))
+        {
+          bool ok_first = true, ok_step = true, ok_last = true;
+          const double first = range.cap(1).toDouble(&ok_first),
+                       step  = range.cap(2).toDouble(&ok_step),
+                       last  = range.cap(3).toDouble(&ok_last);
+
+          if (ok_first && ok_step && ok_last)
+            {
+              QStringList values;
+
+              // the step has to lead from first to last, allow for rounding
+              // errors at the end of the range
+              if (step == 0 || (last - first) / step < 0)
+                return values;
+
+              const double n = std::floor((last - first) / step + 1e-9) + 1;
+              if (n > max_combinations)
+                return values;
+
+              for (int i = 0; i < n; ++i)
+                values.append(QString::number(first + i*step, 'g', 15));
+
+              return values;
+            }
+        }
+
+      QStringList values;
+      foreach (const QString &value, text.split(';'))
+        if (!value.trimmed().isEmpty())
+          values.append(value.trimmed());
+
+      return values;
+    }
+
+
+
+    void ParameterSweep::clear ()
+    {
+      sweep_values.clear();
+    }
+
+
+
+    void ParameterSweep::set_values (const QString     &path,
+                                     const QStringList &values)
+    {
+      if (values.isEmpty())
+        sweep_values.remove(path);
+      else
+        sweep_values.insert(path, values);
+    }
+
+
+
+    QStringList ParameterSweep::values (const QString &path) const
+    {
+      return sweep_values.value(path);
+    }
+
+
+
+    QStringList ParameterSweep::paths () const
+    {
+      return sweep_values.keys();
+    }
+
+
+
+    bool ParameterSweep::is_empty () const
+    {
+      return sweep_values.isEmpty();
+    }
+
+
+
+    int ParameterSweep::product_size () const
+    {
+      qint64 size = 1;
+
+      for (QMap<QString, QStringList>::const_iterator p = sweep_values.constBegin();
+           p != sweep_values.constEnd(); ++p)
+        size = qMin<qint64>(size * p.value().size(), max_combinations + 1);
+
+      return static_cast<int>(size);
+    }
+
+
+
+    QVector<QVector<int> > ParameterSweep::cartesian_product () const
+    {
+      const int size = product_size();
+      if (size > max_combinations)
+        return QVector<QVector<int> >();
+
+      const QList<QStringList> values = sweep_values.values();
+      QVector<QVector<int> > combinations(size, QVector<int>(values.size()));
+
+      // the combination i is the number i in the mixed radix system
+      // given by the numbers of values, with the last parameter
+      // varying fastest
+      for (int i = 0; i < size; ++i)
+        {
+          int rest = i;
+          for (int j = values.size()-1; j >= 0; --j)
+            {
+              combinations[i][j] = rest % values[j].size();
+              rest /= values[j].size();
+            }
+        }
+
+      return combinations;
+    }
+
+
+
+    QVector<QVector<int> > ParameterSweep::latin_hypercube (const int          samples,
+                                                            const unsigned int seed) const
+    {
+      const QList<QStringList> values = sweep_values.values();
+      QVector<QVector<int> > combinations(samples, QVector<int>(values.size()));
+
+      // a linear congruential generator, so the sample is the same everywhere
+      quint64 state = seed;
+      QVector<int> permutation(samples);
+
+      for (int j = 0; j < values.size(); ++j)
+        {
+          // divide the values of each parameter into as many strata as there
+          // are samples and use every stratum once, in random order
+          for (int i = 0; i < samples; ++i)
+            permutation[i] = i;
+
+          for (int i = samples-1; i > 0; --i)
+            {
+              state = state * Q_UINT64_C(6364136223846793005) + Q_UINT64_C(1442695040888963407);
+              qSwap(permutation[i], permutation[(state >> 33) % (i+1)]);
+            }
+
+          for (int i = 0; i < samples; ++i)
+            combinations[i][j] = static_cast<int>(static_cast<qint64>(permutation[i])
+                                                  * values[j].size() / samples);
+        }
+
+      return combinations;
+    }
+
+
+
+    bool ParameterSweep::generate (QIODevice                    *input,
+                                   const QVector<QVector<int> > &combinations,
+                                   const QString                &directory,
+                                   const QString                &base_name,
+                                   const Format                  format)
+    {
+      const QStringList paths = sweep_values.keys();
+      const QList<QStringList> values = sweep_values.values();
+
+      QHash<QString, QString> markers;
+      for (int i = 0; i < paths.size(); ++i)
+        markers.insert(paths[i], marker(i));
+
+      // convert the file once, with markers in place of the swept values
+      QBuffer converted;
+      converted.open(QBuffer::ReadWrite);
+
+      if (format == xml)
+        {
+          XMLParameterOverride value_override(markers);
+
+          if (!value_override.apply(input, &converted))
+            {
+              error = value_override.error_string();
+              return false;
+            }
+        }
+      else
+        {
+          XMLToPRMConverter converter;
+          converter.set_placeholders(markers);
+
+          if (!converter.convert(input, &converted))
+            {
+              error = converter.error_string();
+              return false;
+            }
+        }
+
+      // split the file at the markers
+      SweepTemplate sweep_template;
+      const QByteArray &data = converted.data();
+      const QByteArray marker_begin = "@@parameter_sweep_";
+      QVector<int> occurrences(paths.size(), 0);
+
+      int begin = 0, position = 0;
+      while ((position = data.indexOf(marker_begin, position)) != -1)
+        {
+          const int number_begin = position + marker_begin.size();
+          const int end = data.indexOf("@@", number_begin);
+
+          bool ok = (end != -1);
+          const int parameter = ok ? data.mid(number_begin, end-number_begin).toInt(&ok) : -1;
+
+          if (!ok || parameter < 0 || parameter >= paths.size())
+            {
+              position = number_begin;
+              continue;
+            }
+
+          sweep_template.pieces.append(data.mid(begin, position-begin));
+          sweep_template.parameters.append(parameter);
+          ++occurrences[parameter];
+
+          begin = position = end + 2;
+        }
+      sweep_template.pieces.append(data.mid(begin));
+
+      for (int i = 0; i < paths.size(); ++i)
+        if (occurrences[i] != 1)
+          {
+            error = QObject::tr("The parameter %1 was not found in the file.").arg(paths[i]);
+            return false;
+          }
+
+      // encode every value once, in the same way the writers do
+      for (int i = 0; i < values.size(); ++i)
+        {
+          QVector<QByteArray> encoded;
+          foreach (const QString &value, values[i])
+            if (format == xml)
+              encoded.append(xml_escaped(value).toUtf8());
+            else
+              encoded.append(value.toLatin1());
+
+          sweep_template.values.append(encoded);
+        }
+
+      // number the files with a fixed width, so they are listed in order
+      const QString suffix = (format == xml ? ".xml" : ".prm");
+      const int width = QString::number(combinations.size()).size();
+      QStringList file_names;
+
+      for (int i = 0; i < combinations.size(); ++i)
+        file_names.append(QDir(directory).filePath(QString("%1_%2%3")
+                                                   .arg(base_name)
+                                                   .arg(i+1, width, 10, QChar('0'))
+                                                   .arg(suffix)));
+
+      // write the files in parallel
+      QThreadPool pool;
+      QList<SweepWriter *> writers;
+      const int n_writers = qMax(1, qMin(QThread::idealThreadCount(), combinations.size()));
+
+      for (int i = 0; i < n_writers; ++i)
+        {
+          writers.append(new SweepWriter(sweep_template, combinations, file_names, i, n_writers));
+          pool.start(writers.last());
+        }
+
+      pool.waitForDone();
+
+      error.clear();
+      foreach (SweepWriter *writer, writers)
+        if (error.isEmpty())
+          error = writer->error;
+
+      qDeleteAll(writers);
+
+      if (!error.isEmpty())
+        return false;
+
+      return write_manifest(directory, file_names, combinations);
+    }
+
+
+
+    QString ParameterSweep::error_string () const
+    {
+      return error;
+    }
+
+
+
+    bool ParameterSweep::write_manifest (const QString                &directory,
+                                         const QStringList            &file_names,
+                                         const QVector<QVector<int> > &combinations)
+    {
+      QFile file(QDir(directory).filePath("manifest.csv"));
+
+      if (!file.open(QFile::WriteOnly | QFile::Text))
+        {
+          error = QObject::tr("Cannot write file %1:\n%2.")
+                  .arg(file.fileName())
+                  .arg(file.errorString());
+          return false;
+        }
+
+      const QStringList paths = sweep_values.keys();
+      const QList<QStringList> values = sweep_values.values();
+
+      QStringList header("file");
+      foreach (const QString &path, paths)
+        header.append(csv_field(path));
+      file.write((header.join(",") + "\n").toUtf8());
+
+      for (int i = 0; i < combinations.size(); ++i)
+        {
+          QStringList row(csv_field(QFileInfo(file_names[i]).fileName()));
+          for (int j = 0; j < values.size(); ++j)
+            row.append(csv_field(values[j][combinations[i][j]]));
+
+          file.write((row.join(",") + "\n").toUtf8());
+        }
+
+      return true;
+    }
+  }
+}
@@ -0,0 +1,165 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERSWEEP_H
+#define PARAMETERSWEEP_H
+
+#include <QIODevice>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterSweep class generates the parameter files of a parameter study.
+     * Some parameters, given by their paths, are assigned lists of values, and one
+     * file is written for every combination of these values, either for all of them
+     * (the Cartesian product) or for a Latin hypercube sample, in which every value of
+     * every parameter is used about equally often.
+     *
+     * The files only differ in the values of the swept parameters. Therefore the
+     * parameter file is converted to the output format only once, with a marker in
+     * place of each swept value (see XMLParameterOverride and
+     * XMLToPRMConverter::set_placeholders), and split at the markers. A file is then
+     * written by joining the pieces and the encoded values of one combination, which
+     * costs no more than copying the file. The files are distributed over a number of
+     * QRunnable objects that run on a QThreadPool. Finally a file
+     * <tt>manifest.csv</tt> with the name of every file and the values it was
+     * written with is stored next to the files.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterSweep
+    {
+    public:
+      /**
+       * The formats the files can be written in.
+       */
+      enum Format {xml, prm};
+
+      /**
+       * The largest number of files generated by one sweep.
+       */
+      static const int max_combinations = 1000000;
+
+      /**
+       * Return the values given in @p text, either separated by &quot;;&quot;, or a
+       * range <tt>first:step:last</tt> of numbers. Returns an empty list if @p text
+       * is not a valid range or contains no values.
+       */
+      static QStringList parse_values (const QString &text);
+
+      /**
+       * Remove all parameters from the sweep.
+       */
+      void clear ();
+
+      /**
+       * Sweep the parameter @p path over @p values. An empty list of
+       * @p values removes the parameter from the sweep.
+       */
+      void set_values (const QString     &path,
+                       const QStringList &values);
+
+      /**
+       * Return the values of the parameter @p path, or an empty list if it is not swept.
+       */
+      QStringList values (const QString &path) const;
+
+      /**
+       * Return the paths of the swept parameters in alphabetical order.
+       * This is the order of the values in a combination.
+       */
+      QStringList paths () const;
+
+      /**
+       * Return whether no parameters are swept.
+       */
+      bool is_empty () const;
+
+      /**
+       * Return the number of combinations in the Cartesian product of the values.
+       * The number is capped at <tt>max_combinations</tt>+1.
+       */
+      int product_size () const;
+
+      /**
+       * Return all combinations of the values, as the indices of the values of
+       * the parameters in the order of @ref paths. Returns an empty vector if there
+       * are more than <tt>max_combinations</tt> of them.
+       */
+      QVector<QVector<int> > cartesian_product () const;
+
+      /**
+       * Return a Latin hypercube sample of @p samples combinations, in the same form as
+       * @ref cartesian_product. The sample only depends on @p seed, not on the system
+       * the parameterGUI runs on.
+       */
+      QVector<QVector<int> > latin_hypercube (const int          samples,
+                                              const unsigned int seed = 1) const;
+
+      /**
+       * Read the parameter file in XML format from @p input and write one file for
+       * each of the @p combinations to @p directory in @p format, numbered consecutively
+       * and prefixed by @p base_name, followed by the file <tt>manifest.csv</tt>.
+       * Returns false if a file can not be read or written.
+       */
+      bool generate (QIODevice                    *input,
+                     const QVector<QVector<int> > &combinations,
+                     const QString                &directory,
+                     const QString                &base_name,
+                     const Format                  format);
+
+      /**
+       * This function returns an error message.
+       */
+      QString error_string () const;
+
+    private:
+      /**
+       * Write the manifest of the @p file_names written for @p combinations to @p directory.
+       */
+      bool write_manifest (const QString                &directory,
+                           const QStringList            &file_names,
+                           const QVector<QVector<int> > &combinations);
+
+      /**
+       * The values of the swept parameters by their paths.
+       */
+      QMap<QString, QStringList> sweep_values;
+
+      /**
+       * The message of the last error.
+       */
+      QString error;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,362 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "parameter_table.h"
+#include "prm_parameter_reader.h"
+#include "xml_parameter_reader.h"
+
+#include <QFile>
+#include <QObject>
+#include <QRunnable>
+#include <QThreadPool>
+
+#include <algorithm>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // The values of a file as read by a LoadJob.
+      struct ParsedFile
+      {
+        QVector<QPair<QString, QString> >  values;
+        QString                            error;
+      };
+
+
+
+      // Reads one file into the ParsedFile reserved for it.
+      class LoadJob : public QRunnable
+      {
+      public:
+        LoadJob (const QString &file_name,
+                 ParsedFile    *result)
+          : file_name(file_name),
+            result(result)
+        {
+        }
+
+        void run ()
+        {
+          QFile file(file_name);
+          if (!file.open(QFile::ReadOnly | QFile::Text))
+            {
+              result->error = QObject::tr("%1: %2").arg(file_name).arg(file.errorString());
+              return;
+            }
+
+          QString error;
+
+          if (file_name.endsWith(".prm", Qt::CaseInsensitive))
+            {
+              PRMParameterReader reader;
+              if (!reader.read_prm_file(&file))
+                error = reader.error_string();
+              else
+                {
+                  const QHash<QString, QString> values = reader.values();
+                  result->values.reserve(values.size());
+
+                  for (QHash<QString, QString>::const_iterator p = values.constBegin();
+                       p != values.constEnd(); ++p)
+                    result->values.append(qMakePair(p.key(), p.value()));
+                }
+            }
+          else
+            {
+              QVector<XMLParameterReader::Parameter> parameters;
+              if (XMLParameterReader::read_parameters(&file, parameters, error))
+                {
+                  result->values.reserve(parameters.size());
+
+                  foreach (const XMLParameterReader::Parameter &parameter, parameters)
+                    result->values.append(qMakePair(parameter.path, parameter.value));
+                }
+            }
+
+          if (!error.isEmpty())
+            result->error = QObject::tr("%1: %2").arg(file_name).arg(error);
+        }
+
+      private:
+        const QString  file_name;
+        ParsedFile    *result;
+      };
+
+
+
+      // Order the values of a distribution by their frequency.
+      bool more_frequent (const QPair<QString, int> &a,
+                          const QPair<QString, int> &b)
+      {
+        return a.second > b.second;
+      }
+
+
+
+      // Quote a field of a CSV file if needed.
+      QString csv_field (const QString &s)
+      {
+        if (!s.contains(',') && !s.contains('"') && !s.contains('\n'))
+          return s;
+
+        QString quoted = s;
+        quoted.replace('"', "\"\"");
+        return '"' + quoted + '"';
+      }
+    }
+
+
+
+    void ParameterTable::clear ()
+    {
+      files.clear();
+      load_errors.clear();
+      columns.clear();
+      column_index.clear();
+    }
+
+
+
+    void ParameterTable::load (const QStringList &file_names)
+    {
+      clear();
+      files = file_names;
+
+      const int n_files = file_names.size();
+
+      // the dictionaries of the columns, only needed while the table is built
+      QVector<QHash<QString, int> > codes_by_value;
+      QVector<int> failed_files;
+
+      QThreadPool pool;
+      const int batch_size = 16 * qMax(1, pool.maxThreadCount());
+
+      for (int begin = 0; begin < n_files; begin += batch_size)
+        {
+          const int end = qMin(begin + batch_size, n_files);
+
+          // read a batch of files in parallel, every job writes to its own result
+          QVector<ParsedFile> parsed(end - begin);
+          ParsedFile *results = parsed.data();
+
+          for (int f = begin; f < end; ++f)
+            pool.start(new LoadJob(file_names[f], results + f - begin));
+
+          pool.waitForDone();
+
+          // and add their values to the columns
+          for (int f = begin; f < end; ++f)
+            {
+              const ParsedFile &file = parsed[f - begin];
+
+              if (!file.error.isEmpty())
+                {
+                  load_errors.append(file.error);
+                  failed_files.append(f);
+                  continue;
+                }
+
+              // most files list the parameters in the same order,
+              // so the next column is usually the right one
+              int next_column = 0;
+
+              for (int i = 0; i < file.values.size(); ++i)
+                {
+                  const QString &path = file.values[i].first;
+                  const QString &value = file.values[i].second;
+
+                  int c = next_column;
+                  if (c >= columns.size() || columns[c].path != path)
+                    {
+                      const QHash<QString, int>::const_iterator p = column_index.constFind(path);
+
+                      if (p != column_index.constEnd())
+                        c = p.value();
+                      else
+                        {
+                          Column new_column;
+                          new_column.path = path;
+                          new_column.codes = QVector<int>(n_files, -1);
+
+                          c = columns.size();
+                          columns.append(new_column);
+                          column_index.insert(path, c);
+                          codes_by_value.append(QHash<QString, int>());
+                        }
+                    }
+                  next_column = c + 1;
+
+                  Column &column = columns[c];
+
+                  // most parameters have the same value as in the previous file
+                  int code = (f > 0 ? column.codes[f-1] : -1);
+                  if (code == -1 || column.dictionary[code] != value)
+                    {
+                      const QHash<QString, int>::const_iterator p = codes_by_value[c].constFind(value);
+
+                      if (p != codes_by_value[c].constEnd())
+                        code = p.value();
+                      else
+                        {
+                          code = column.dictionary.size();
+                          // empty values are read as null strings, which mark
+                          // files without the parameter in a distribution
+                          column.dictionary.append(value.isNull() ? QString("") : value);
+                          codes_by_value[c].insert(value, code);
+                        }
+                    }
+
+                  column.codes[f] = code;
+                }
+            }
+        }
+
+      // remove the rows of the files that could not be read, so
+      // that they do not count as files without the parameters
+      if (!failed_files.isEmpty())
+        {
+          QVector<int> kept;
+          for (int f = 0, i = 0; f < n_files; ++f)
+            if (i < failed_files.size() && failed_files[i] == f)
+              ++i;
+            else
+              kept.append(f);
+
+          QStringList kept_files;
+          for (int k = 0; k < kept.size(); ++k)
+            kept_files.append(files[kept[k]]);
+          files = kept_files;
+
+          for (int c = 0; c < columns.size(); ++c)
+            {
+              QVector<int> codes(kept.size());
+              for (int k = 0; k < kept.size(); ++k)
+                codes[k] = columns[c].codes[kept[k]];
+              columns[c].codes = codes;
+            }
+        }
+    }
+
+
+
+    QStringList ParameterTable::file_names () const
+    {
+      return files;
+    }
+
+
+
+    QStringList ParameterTable::errors () const
+    {
+      return load_errors;
+    }
+
+
+
+    int ParameterTable::column_count () const
+    {
+      return columns.size();
+    }
+
+
+
+    const ParameterTable::Column &ParameterTable::column (const int column) const
+    {
+      return columns[column];
+    }
+
+
+
+    int ParameterTable::cardinality (const int column) const
+    {
+      return columns[column].dictionary.size()
+             + (columns[column].codes.contains(-1) ? 1 : 0);
+    }
+
+
+
+    QVector<int> ParameterTable::varying_columns () const
+    {
+      // sort by the negative cardinality, so the most values come first,
+      // and keep the order of the columns otherwise
+      QVector<QPair<int, int> > order;
+      for (int c = 0; c < columns.size(); ++c)
+        {
+          const int n_values = cardinality(c);
+          if (n_values > 1)
+            order.append(qMakePair(-n_values, c));
+        }
+
+      std::sort(order.begin(), order.end());
+
+      QVector<int> varying(order.size());
+      for (int i = 0; i < order.size(); ++i)
+        varying[i] = order[i].second;
+
+      return varying;
+    }
+
+
+
+    QVector<QPair<QString, int> > ParameterTable::distribution (const int column) const
+    {
+      const Column &values = columns[column];
+
+      // count the codes, shifted by one for files without the parameter
+      QVector<int> counts(values.dictionary.size() + 1, 0);
+      for (int f = 0; f < values.codes.size(); ++f)
+        ++counts[values.codes[f] + 1];
+
+      QVector<QPair<QString, int> > distribution;
+      for (int code = -1; code < values.dictionary.size(); ++code)
+        if (counts[code + 1] > 0)
+          distribution.append(qMakePair(code == -1 ? QString() : values.dictionary[code],
+                                        counts[code + 1]));
+
+      std::stable_sort(distribution.begin(), distribution.end(), more_frequent);
+
+      return distribution;
+    }
+
+
+
+    void ParameterTable::write_csv (QIODevice          *device,
+                                    const QVector<int> &columns) const
+    {
+      QStringList header("file");
+      for (int i = 0; i < columns.size(); ++i)
+        header.append(csv_field(this->columns[columns[i]].path));
+      device->write((header.join(",") + "\n").toUtf8());
+
+      for (int f = 0; f < files.size(); ++f)
+        {
+          QStringList row(csv_field(files[f]));
+          for (int i = 0; i < columns.size(); ++i)
+            {
+              const Column &column = this->columns[columns[i]];
+              const int code = column.codes[f];
+
+              row.append(code == -1 ? QString() : csv_field(column.dictionary[code]));
+            }
+
+          device->write((row.join(",") + "\n").toUtf8());
+        }
+    }
+  }
+}
@@ -0,0 +1,153 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PARAMETERTABLE_H
+#define PARAMETERTABLE_H
+
+#include <QHash>
+#include <QIODevice>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterTable class stores the parameter values of many files, e.g. of all
+     * runs of a campaign, to find out which parameters actually differ between them and
+     * how their values are distributed. The table has a row for every file and a column
+     * for every parameter path that occurs in any file.
+     *
+     * The values are stored by column and dictionary-encoded: every column stores each
+     * distinct value once and, for every file, the index of its value, or -1 if the
+     * file does not set the parameter, e.g. because it is a PRM file and the value is
+     * the default. Most parameters take very few values, so the table needs little more
+     * than one integer per file and parameter, about 400 MB for 10000 files with 10000
+     * parameters each.
+     *
+     * Files are read in batches on a QThreadPool, XML files with
+     * XMLParameterReader::read_parameters and PRM files with the @ref PRMParameterReader,
+     * and the values of each batch are added to the columns before the next batch is
+     * read, so the values of only a few files are held as text at any time.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterTable
+    {
+    public:
+      /**
+       * The values of one parameter in all files.
+       */
+      struct Column
+      {
+        QString        path;
+        QStringList    dictionary;
+        QVector<int>   codes;
+      };
+
+      /**
+       * Remove all files and columns.
+       */
+      void clear ();
+
+      /**
+       * Replace the contents of the table by the parameter files @p file_names. Files that
+       * can not be read are not added, their errors are returned by @ref errors.
+       */
+      void load (const QStringList &file_names);
+
+      /**
+       * Return the files in the table, one for every row.
+       */
+      QStringList file_names () const;
+
+      /**
+       * Return the messages of the files that could not be read.
+       */
+      QStringList errors () const;
+
+      /**
+       * Return the number of columns.
+       */
+      int column_count () const;
+
+      /**
+       * Return the column with index @p column.
+       */
+      const Column &column (const int column) const;
+
+      /**
+       * Return the number of distinct values in @p column. Files that
+       * do not set the parameter count as one more value.
+       */
+      int cardinality (const int column) const;
+
+      /**
+       * Return the columns with more than one distinct value,
+       * the columns with the most values first.
+       */
+      QVector<int> varying_columns () const;
+
+      /**
+       * Return the values of @p column with the number of files they occur in, the most
+       * frequent first. Files that do not set the parameter are counted as a null QString.
+       */
+      QVector<QPair<QString, int> > distribution (const int column) const;
+
+      /**
+       * Write the table with the given @p columns to @p device as CSV,
+       * with the file names in the first column.
+       */
+      void write_csv (QIODevice          *device,
+                      const QVector<int> &columns) const;
+
+    private:
+      /**
+       * The files in the table.
+       */
+      QStringList files;
+
+      /**
+       * The messages of the files that could not be read.
+       */
+      QStringList load_errors;
+
+      /**
+       * The columns of the table.
+       */
+      QVector<Column> columns;
+
+      /**
+       * The indices of the columns by their paths.
+       */
+      QHash<QString, int> column_index;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,318 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#include "parameter_value.h"
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // The comparison of two values of the same type, the
+      // dispatch on the type is done once in operator==.
+      template <ParameterValue::Type type>
+      struct Comparator;
+
+      template <>
+      struct Comparator<ParameterValue::integer>
+      {
+        static bool equal (const ParameterValue &a, const ParameterValue &b)
+        {
+          return a.to_integer() == b.to_integer();
+        }
+      };
+
+      template <>
+      struct Comparator<ParameterValue::floating_point>
+      {
+        static bool equal (const ParameterValue &a, const ParameterValue &b)
+        {
+          return a.to_double() == b.to_double();
+        }
+      };
+
+      template <>
+      struct Comparator<ParameterValue::boolean>
+      {
+        static bool equal (const ParameterValue &a, const ParameterValue &b)
+        {
+          return a.to_bool() == b.to_bool();
+        }
+      };
+
+      template <>
+      struct Comparator<ParameterValue::selection>
+      {
+        static bool equal (const ParameterValue &a, const ParameterValue &b)
+        {
+          return a.selection_index() == b.selection_index();
+        }
+      };
+
+      template <>
+      struct Comparator<ParameterValue::multiple_selection>
+      {
+        static bool equal (const ParameterValue &a, const ParameterValue &b)
+        {
+          return a.selected_choices() == b.selected_choices();
+        }
+      };
+
+      template <>
+      struct Comparator<ParameterValue::string>
+      {
+        static bool equal (const ParameterValue &a, const ParameterValue &b)
+        {
+          // values read from the same text share their data
+          return (a.string_value().constData() == b.string_value().constData()) ||
+                 (a.string_value() == b.string_value());
+        }
+      };
+    }
+
+
+
+    ParameterValue::ParameterValue ()
+                  : value_type(invalid),
+                    integer_value(0)
+    {
+    }
+
+
+
+    bool ParameterValue::equal (const QVariant         &value_1,
+                                const QVariant         &value_2,
+                                const ParameterPattern &pattern)
+    {
+      return from_variant(value_1, pattern) == from_variant(value_2, pattern);
+    }
+
+
+
+    ParameterValue ParameterValue::from_variant (const QVariant         &value,
+                                                 const ParameterPattern &pattern)
+    {
+      ParameterValue result;
+
+      switch (pattern.kind)
+        {
+          case ParameterPattern::integer:
+            {
+              bool ok = true;
+              const qint64 number = value.toLongLong(&ok);
+              if (ok)
+                {
+                  result.value_type = integer;
+                  result.integer_value = number;
+                  return result;
+                }
+              break;
+            }
+
+          case ParameterPattern::floating_point:
+            {
+              bool ok = true;
+              const double number = value.toDouble(&ok);
+              if (ok)
+                {
+                  result.value_type = floating_point;
+                  result.double_value = number;
+                  return result;
+                }
+              break;
+            }
+
+          case ParameterPattern::boolean:
+            {
+              // the reader stores booleans as bool, default values are strings
+              if (value.type() == QVariant::Bool)
+                {
+                  result.value_type = boolean;
+                  result.bool_value = value.toBool();
+                  return result;
+                }
+
+              const QString text = value.toString();
+              if (text == "true" || text == "false")
+                {
+                  result.value_type = boolean;
+                  result.bool_value = (text == "true");
+                  return result;
+                }
+              break;
+            }
+
+          case ParameterPattern::selection:
+            {
+              const int choice = pattern.choice_positions.value(value.toString(), -1);
+              if (choice != -1)
+                {
+                  result.value_type = selection;
+                  result.index = choice;
+                  return result;
+                }
+              break;
+            }
+
+          case ParameterPattern::multiple_selection:
+            {
+              bool ok = true;
+              const QBitArray selected = pattern.selected_choices(value.toString(), &ok);
+              if (ok)
+                {
+                  result.value_type = multiple_selection;
+                  result.selected = selected;
+                  return result;
+                }
+              break;
+            }
+
+          default:
+            break;
+        }
+
+      // the string shares its data with the value it was read from
+      result.value_type = string;
+      result.text = value.toString();
+      return result;
+    }
+
+
+
+    QString ParameterValue::to_string (const ParameterPattern &pattern) const
+    {
+      switch (value_type)
+        {
+          case integer:
+            return QString::number(integer_value);
+
+          case floating_point:
+            {
+              // the shortest of the precisions that keep the value
+              const QString text = QString::number(double_value, 'g', 15);
+              if (text.toDouble() == double_value)
+                return text;
+              return QString::number(double_value, 'g', 17);
+            }
+
+          case boolean:
+            return (bool_value ? "true" : "false");
+
+          case selection:
+            return pattern.choices.value(index);
+
+          case multiple_selection:
+            return pattern.selection_value(selected);
+
+          case string:
+            return text;
+
+          default:
+            return QString();
+        }
+    }
+
+
+
+    ParameterValue::Type ParameterValue::type () const
+    {
+      return value_type;
+    }
+
+
+
+    qint64 ParameterValue::to_integer () const
+    {
+      return integer_value;
+    }
+
+
+
+    double ParameterValue::to_double () const
+    {
+      return double_value;
+    }
+
+
+
+    bool ParameterValue::to_bool () const
+    {
+      return bool_value;
+    }
+
+
+
+    int ParameterValue::selection_index () const
+    {
+      return index;
+    }
+
+
+
+    const QBitArray &ParameterValue::selected_choices () const
+    {
+      return selected;
+    }
+
+
+
+    const QString &ParameterValue::string_value () const
+    {
+      return text;
+    }
+
+
+
+    bool ParameterValue::operator == (const ParameterValue &other) const
+    {
+      if (value_type != other.value_type)
+        return false;
+
+      switch (value_type)
+        {
+          case integer:
+            return Comparator<integer>::equal(*this, other);
+
+          case floating_point:
+            return Comparator<floating_point>::equal(*this, other);
+
+          case boolean:
+            return Comparator<boolean>::equal(*this, other);
+
+          case selection:
+            return Comparator<selection>::equal(*this, other);
+
+          case multiple_selection:
+            return Comparator<multiple_selection>::equal(*this, other);
+
+          case string:
+            return Comparator<string>::equal(*this, other);
+
+          default:
+            return true;
+        }
+    }
+
+
+
+    bool ParameterValue::operator != (const ParameterValue &other) const
+    {
+      return !(*this == other);
+    }
+  }
+}
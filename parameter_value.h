@@ -0,0 +1,173 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#ifndef PARAMETERVALUE_H
+#define PARAMETERVALUE_H
+
+#include <QBitArray>
+#include <QMetaType>
+#include <QString>
+#include <QVariant>
+
+#include "parameter_pattern.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterValue class stores the value of a parameter in a compact, typed form:
+     * integers, floating point numbers and booleans are stored as numbers, choices of
+     * &quot;Selection&quot; patterns by their index in the list of choices, choices of
+     * &quot;MultipleSelection&quot; patterns as a bit for each choice and all other
+     * values as the string itself, which shares its data with the string it was
+     * converted from. Only values of these other patterns compare strings. Which type is
+     * used follows from the pattern the value was converted with, values that do not
+     * satisfy their pattern, e.g. a selection that is not one of the choices, are
+     * stored as strings.
+     *
+     * Values are stored in the items of the parameter tree, see ParameterItem, to
+     * decide whether a parameter has its default value or was modified.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterValue
+    {
+    public:
+      /**
+       * The types a value can be stored as.
+       */
+      enum Type {invalid = 0, integer, floating_point, boolean, selection, multiple_selection, string};
+
+      /**
+       * Constructor. Creates an invalid value.
+       */
+      ParameterValue ();
+
+      /**
+       * Return @p value, as it is stored in the parameter tree, converted
+       * to the type that fits @p pattern.
+       */
+      static ParameterValue from_variant (const QVariant         &value,
+                                          const ParameterPattern &pattern);
+
+      /**
+       * Return whether @p value_1 and @p value_2 are the same value of a parameter
+       * with @p pattern, i.e. whether their conversions are equal.
+       */
+      static bool equal (const QVariant         &value_1,
+                         const QVariant         &value_2,
+                         const ParameterPattern &pattern);
+
+      /**
+       * Return the value as it is written to a parameter file. @p pattern has
+       * to be the pattern the value was converted with. Floating point numbers
+       * are written with 15 digits, or 17 if fewer do not keep their value.
+       */
+      QString to_string (const ParameterPattern &pattern) const;
+
+      /**
+       * Return the type of the value.
+       */
+      Type type () const;
+
+      /**
+       * Return the value of an <tt>integer</tt>.
+       */
+      qint64 to_integer () const;
+
+      /**
+       * Return the value of a <tt>floating_point</tt> number.
+       */
+      double to_double () const;
+
+      /**
+       * Return the value of a <tt>boolean</tt>.
+       */
+      bool to_bool () const;
+
+      /**
+       * Return the index of a <tt>selection</tt> in the choices of its pattern.
+       */
+      int selection_index () const;
+
+      /**
+       * Return the bits of the choices a <tt>multiple_selection</tt> selects.
+       * Two values select the same choices if these are equal, independently
+       * of the order and spacing the choices were written with.
+       */
+      const QBitArray &selected_choices () const;
+
+      /**
+       * Return the value of a <tt>string</tt>.
+       */
+      const QString &string_value () const;
+
+      /**
+       * Return whether this value and @p other have the same type and value.
+       * Floating point numbers are compared as numbers, e.g. &quot;1&quot;
+       * and &quot;1.0&quot; are the same value.
+       */
+      bool operator == (const ParameterValue &other) const;
+
+      /**
+       * Return whether this value and @p other differ.
+       */
+      bool operator != (const ParameterValue &other) const;
+
+    private:
+      /**
+       * The type of the value.
+       */
+      Type  value_type;
+
+      /**
+       * The value, interpreted according to <tt>value_type</tt>.
+       */
+      union
+      {
+        qint64  integer_value;
+        double  double_value;
+        bool    bool_value;
+        int     index;
+      };
+
+      /**
+       * The choices of a <tt>multiple_selection</tt>. Empty for all other types.
+       */
+      QBitArray  selected;
+
+      /**
+       * The value of a <tt>string</tt>. Empty for all other types.
+       */
+      QString  text;
+    };
+  }
+  /**@}*/
+}
+
+Q_DECLARE_METATYPE(dealii::ParameterGui::ParameterValue)
+
+
+#endif
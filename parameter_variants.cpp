@@ -0,0 +1,109 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#include "parameter_variants.h"
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    void ParameterVariants::clear (const QString &name)
+    {
+      differences.clear();
+      file_values.clear();
+
+      differences.insert(name, QHash<int, QVariant>());
+      active_name = name;
+    }
+
+
+
+    QStringList ParameterVariants::names () const
+    {
+      return differences.keys();
+    }
+
+
+
+    QString ParameterVariants::active () const
+    {
+      return active_name;
+    }
+
+
+
+    bool ParameterVariants::contains (const QString &name) const
+    {
+      return differences.contains(name);
+    }
+
+
+
+    void ParameterVariants::record (const int       id,
+                                    const QVariant &old_value,
+                                    const QVariant &new_value,
+                                    const bool      modified)
+    {
+      QHash<int, QVariant> &active_differences = differences[active_name];
+
+      // parameters that do not differ in the active variant have the value
+      // read from the file, so the first change tells us this value
+      if (!active_differences.contains(id) && !file_values.contains(id))
+        file_values.insert(id, old_value);
+
+      if (modified)
+        active_differences.insert(id, new_value);
+      else
+        active_differences.remove(id);
+    }
+
+
+
+    void ParameterVariants::add (const QString &name)
+    {
+      // implicitly shared until one of the variants changes
+      differences.insert(name, differences.value(active_name));
+    }
+
+
+
+    void ParameterVariants::remove (const QString &name)
+    {
+      if (name != active_name)
+        differences.remove(name);
+    }
+
+
+
+    QHash<int, QVariant> ParameterVariants::switch_to (const QString &name)
+    {
+      const QHash<int, QVariant> &old_differences = differences[active_name];
+      const QHash<int, QVariant> &new_differences = differences[name];
+
+      QHash<int, QVariant> values = new_differences;
+
+      // parameters that only differ in the old variant get back the value from the file
+      for (QHash<int, QVariant>::const_iterator p = old_differences.constBegin();
+           p != old_differences.constEnd(); ++p)
+        if (!new_differences.contains(p.key()))
+          values.insert(p.key(), file_values.value(p.key()));
+
+      active_name = name;
+      return values;
+    }
+  }
+}
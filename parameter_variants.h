@@ -0,0 +1,126 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#ifndef PARAMETERVARIANTS_H
+#define PARAMETERVARIANTS_H
+
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The ParameterVariants class manages named variants of the loaded parameter file,
+     * e.g. for a coarse and a fine mesh. Only the values of the active variant are
+     * stored in the parameter tree. Every variant is stored as the values that differ
+     * from the values read from the file, by parameter id (see @ref ParameterPathIndex),
+     * and the values read from the file are stored for the parameters that differ in
+     * any variant. The memory needed for N variants is therefore that of the tree plus
+     * the differences. A new variant is a copy of the active one, which shares its
+     * data with it until one of them is changed.
+     *
+     * The differences of the active variant are kept up to date with @ref record.
+     * Switching to another variant with @ref switch_to returns the values of the
+     * parameters that differ in either of the two variants, so only those have to
+     * be updated in the tree.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class ParameterVariants
+    {
+    public:
+      /**
+       * Remove all variants and create the variant @p name
+       * without differences, which is the active one.
+       */
+      void clear (const QString &name);
+
+      /**
+       * Return the names of all variants in alphabetical order.
+       */
+      QStringList names () const;
+
+      /**
+       * Return the name of the active variant.
+       */
+      QString active () const;
+
+      /**
+       * Return whether there is a variant called @p name.
+       */
+      bool contains (const QString &name) const;
+
+      /**
+       * Record that the value of parameter @p id in the active variant changed from
+       * @p old_value to @p new_value. @p modified tells whether the new value differs
+       * from the value read from the file.
+       */
+      void record (const int       id,
+                   const QVariant &old_value,
+                   const QVariant &new_value,
+                   const bool      modified);
+
+      /**
+       * Add the variant @p name as a copy of the active variant.
+       */
+      void add (const QString &name);
+
+      /**
+       * Remove the variant @p name, which must not be the active one.
+       */
+      void remove (const QString &name);
+
+      /**
+       * Make @p name the active variant and return the values by id of the
+       * parameters that differ between the previously active variant and it.
+       */
+      QHash<int, QVariant> switch_to (const QString &name);
+
+    private:
+      /**
+       * The values that differ from the values read from the file, for each variant.
+       */
+      QMap<QString, QHash<int, QVariant> > differences;
+
+      /**
+       * The values read from the file of all parameters that differ in any variant.
+       */
+      QHash<int, QVariant> file_values;
+
+      /**
+       * The name of the active variant.
+       */
+      QString active_name;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,162 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "path_checker.h"
+
+#include <QFileInfo>
+#include <QMetaObject>
+#include <QRunnable>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // the number of paths checked by one task
+      const int batch_size = 64;
+
+
+
+      // Checks a batch of paths and hands the results to the checker.
+      class CheckBatch : public QRunnable
+      {
+      public:
+        CheckBatch (PathChecker       *checker,
+                    const QStringList &paths)
+          : checker(checker),
+            paths(paths)
+        {
+        }
+
+        void run ()
+        {
+          QVariantList states;
+
+          foreach (const QString &path, paths)
+            {
+              const QFileInfo info(path);
+
+              if (info.isDir())
+                states.append(static_cast<int>(PathChecker::directory));
+              else if (info.exists())
+                states.append(static_cast<int>(PathChecker::file));
+              else
+                states.append(static_cast<int>(PathChecker::missing));
+            }
+
+          // the checker waits for all batches before it is destroyed
+          QMetaObject::invokeMethod(checker, "store_results", Qt::QueuedConnection,
+                                    Q_ARG(QStringList, paths),
+                                    Q_ARG(QVariantList, states));
+        }
+
+      private:
+        PathChecker  *checker;
+        QStringList   paths;
+      };
+    }
+
+
+
+    PathChecker::PathChecker(const int time_to_live,
+                             QObject *parent)
+               : QObject(parent),
+                 time_to_live(time_to_live)
+    {
+      clock.start();
+
+      batch_timer = new QTimer(this);
+      batch_timer->setSingleShot(true);
+      batch_timer->setInterval(0);
+      connect(batch_timer, SIGNAL(timeout()), this, SLOT(start_checks()));
+    }
+
+
+
+    PathChecker::~PathChecker()
+    {
+      pool.waitForDone();
+    }
+
+
+
+    void PathChecker::check(const QString &path)
+    {
+      if (pending.contains(path))
+        return;
+
+      const QHash<QString, Entry>::const_iterator p = results.constFind(path);
+      if (p != results.constEnd() && clock.elapsed() - p.value().time < time_to_live)
+        return;
+
+      pending.insert(path);
+      queue.append(path);
+
+      if (!batch_timer->isActive())
+        batch_timer->start();
+    }
+
+
+
+    PathChecker::State PathChecker::state(const QString &path) const
+    {
+      const QHash<QString, Entry>::const_iterator p = results.constFind(path);
+
+      if (p == results.constEnd())
+        return unknown;
+
+      return p.value().state;
+    }
+
+
+
+    void PathChecker::clear()
+    {
+      results.clear();
+    }
+
+
+
+    void PathChecker::start_checks()
+    {
+      for (int begin = 0; begin < queue.size(); begin += batch_size)
+        pool.start(new CheckBatch(this, queue.mid(begin, batch_size)));
+
+      queue.clear();
+    }
+
+
+
+    void PathChecker::store_results(const QStringList  &paths,
+                                    const QVariantList &states)
+    {
+      const qint64 now = clock.elapsed();
+
+      for (int i = 0; i < paths.size(); ++i)
+        {
+          Entry entry;
+          entry.state = static_cast<State>(states[i].toInt());
+          entry.time = now;
+
+          results.insert(paths[i], entry);
+          pending.remove(paths[i]);
+        }
+
+      emit checked(paths);
+    }
+  }
+}
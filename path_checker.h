@@ -0,0 +1,161 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PATHCHECKER_H
+#define PATHCHECKER_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QThreadPool>
+#include <QTimer>
+#include <QVariant>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The PathChecker class checks in the background whether files and directories
+     * exist, e.g. those named by &quot;FileName&quot; and &quot;DirectoryName&quot;
+     * parameters. On slow or shared filesystems a single <tt>stat</tt> call may take a
+     * long time, so the checks are never done in the thread of the GUI.
+     *
+     * Paths passed to @ref check are collected until control returns to the event loop
+     * and then checked in batches on a QThreadPool. The results are cached and the
+     * signal @ref checked is emitted with the paths of each batch when its results are
+     * available. A cached result is used for <tt>time_to_live</tt> milliseconds, after
+     * that the path is checked again the next time it is passed to @ref check. Paths
+     * that are being checked are not checked a second time.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class PathChecker : public QObject
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * The results of a check.
+       */
+      enum State {unknown = 0, missing, file, directory};
+
+      /**
+       * Constructor. Results are cached for @p time_to_live milliseconds.
+       */
+      PathChecker (const int time_to_live = 10000,
+                   QObject *parent = 0);
+
+      /**
+       * Destructor. Waits for the running checks to finish.
+       */
+      ~PathChecker ();
+
+      /**
+       * Check whether @p path exists, unless there is a cached result that is not expired.
+       */
+      void check (const QString &path);
+
+      /**
+       * Return the last result for @p path, even if it is expired,
+       * or <tt>unknown</tt> if it was not checked yet.
+       */
+      State state (const QString &path) const;
+
+      /**
+       * Forget all results.
+       */
+      void clear ();
+
+    signals:
+      /**
+       * The results for @p paths are available.
+       */
+      void checked (const QStringList &paths);
+
+    private slots:
+      /**
+       * Check the collected paths in batches on <tt>pool</tt>.
+       */
+      void start_checks ();
+
+      /**
+       * Store the @p states of @p paths, called in the thread of this object
+       * when a batch is finished.
+       */
+      void store_results (const QStringList  &paths,
+                          const QVariantList &states);
+
+    private:
+      /**
+       * A cached result and the time it was checked at.
+       */
+      struct Entry
+      {
+        State   state;
+        qint64  time;
+      };
+
+      /**
+       * The time results are cached for, in milliseconds.
+       */
+      int time_to_live;
+
+      /**
+       * The clock the times of the results are measured with.
+       */
+      QElapsedTimer clock;
+
+      /**
+       * The results by path.
+       */
+      QHash<QString, Entry> results;
+
+      /**
+       * The paths that are collected or being checked.
+       */
+      QSet<QString> pending;
+
+      /**
+       * The paths that are collected for the next batches.
+       */
+      QStringList queue;
+
+      /**
+       * The timer that triggers start_checks() once control returns to the event loop.
+       */
+      QTimer *batch_timer;
+
+      /**
+       * The threads the checks run in.
+       */
+      QThreadPool pool;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
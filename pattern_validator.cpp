@@ -0,0 +1,553 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "pattern_validator.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QStringList>
+
+#include <algorithm>
+#include <limits>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // If @p description continues with @p text at @p position,
+      // move @p position behind it and return true.
+      bool skip (const QString &description,
+                 int           &position,
+                 const char    *text)
+      {
+        const QLatin1String expected(text);
+        const int length = static_cast<int>(qstrlen(text));
+
+        if (description.midRef(position, length) != expected)
+          return false;
+
+        position += length;
+        return true;
+      }
+
+
+
+      // Return the position of the ']' that closes a pattern whose nested patterns
+      // end before @p position. Separators in angle brackets may contain ']'.
+      int closing_bracket (const QString &description,
+                           int            position)
+      {
+        for (; position < description.size(); ++position)
+          if (description[position] == QLatin1Char('<'))
+            {
+              position = description.indexOf('>', position+1);
+              if (position == -1)
+                return -1;
+            }
+          else if (description[position] == QLatin1Char(']'))
+            return position;
+
+        return -1;
+      }
+
+
+
+      // Find the bounds "min...max" in @p text, e.g. in " range 0...10 (inclusive)".
+      bool find_range (const QString &text,
+                       QString       &min,
+                       QString       &max)
+      {
+        const int dots = text.indexOf("...");
+        if (dots == -1)
+          return false;
+
+        const int min_begin = text.lastIndexOf(' ', dots) + 1;
+        int max_end = text.indexOf(' ', dots);
+        if (max_end == -1)
+          max_end = text.size();
+
+        min = text.mid(min_begin, dots-min_begin);
+        max = text.mid(dots+3, max_end-dots-3);
+        return true;
+      }
+
+
+
+      // Convert a bound of a "Double" pattern, which may be given as MAX_DOUBLE.
+      double to_double_bound (const QString &bound,
+                              const double   default_value)
+      {
+        if (bound == "MAX_DOUBLE")
+          return std::numeric_limits<double>::max();
+        if (bound == "-MAX_DOUBLE")
+          return -std::numeric_limits<double>::max();
+
+        bool ok = true;
+        const double value = bound.toDouble(&ok);
+        return ok ? value : default_value;
+      }
+
+
+
+      // Convert a bound of an "Integer" or of a length.
+      qint64 to_integer_bound (const QString &bound,
+                               const qint64   default_value)
+      {
+        bool ok = true;
+        const qint64 value = bound.toLongLong(&ok);
+        return ok ? value : default_value;
+      }
+
+
+
+      // Remove white space from both ends of the range from @p begin to @p end.
+      void trim (const QChar *&begin,
+                 const QChar *&end)
+      {
+        while (begin < end && begin->isSpace())
+          ++begin;
+        while (end > begin && (end-1)->isSpace())
+          --end;
+      }
+
+
+
+      // Return the first occurrence of @p separator in the range
+      // from @p begin to @p end, or @p end if there is none.
+      const QChar *find (const QChar   *begin,
+                         const QChar   *end,
+                         const QString &separator)
+      {
+        const int length = separator.size();
+        if (length == 0)
+          return end;
+
+        const QChar *s = separator.constData();
+        for (const QChar *p = begin; p + length <= end; ++p)
+          if (*p == *s && std::equal(s, s+length, p))
+            return p;
+
+        return end;
+      }
+    }
+
+
+
+    PatternValidator::Node::Node ()
+                     : kind(unknown),
+                       min_integer(std::numeric_limits<int>::min()),
+                       max_integer(std::numeric_limits<int>::max()),
+                       min_double(-std::numeric_limits<double>::max()),
+                       max_double(std::numeric_limits<double>::max()),
+                       min_length(0),
+                       max_length(std::numeric_limits<qint64>::max()),
+                       separator(","),
+                       key_value_separator(":")
+    {
+    }
+
+
+
+    PatternValidator::PatternValidator ()
+    {
+    }
+
+
+
+    PatternValidator::PatternValidator (const QString &pattern_description)
+    {
+      int position = 0;
+
+      // a description that is only partly understood
+      // must not reject values, so drop all of it
+      if (parse(pattern_description, position) == -1)
+        nodes.clear();
+    }
+
+
+
+    int PatternValidator::parse (const QString &description,
+                                 int           &position)
+    {
+      while (position < description.size() && description[position].isSpace())
+        ++position;
+
+      const int begin = position;
+      if (!skip(description, position, "["))
+        return -1;
+
+      int keyword_end = position;
+      while (keyword_end < description.size() && description[keyword_end].isLetter())
+        ++keyword_end;
+
+      const QString keyword = description.mid(position, keyword_end-position);
+      position = keyword_end;
+
+      // nested patterns are appended behind this one, so
+      // its node is only accessed by its position
+      const int node = nodes.size();
+      nodes.append(Node());
+
+      // composite patterns are of the form
+      // "[List of <[...]> of length 0...10 (inclusive) separated by <;>]",
+      // "[Map of <[...]>:<[...]> of length 0...10 (inclusive) separated by <;>]" or
+      // "[Tuple of <2> elements <[...]>, <[...]> separated by <;>]"
+      if (keyword == "List" || keyword == "Map")
+        {
+          if (!skip(description, position, " of <"))
+            return -1;
+
+          const int element = parse(description, position);
+          if (element == -1 || !skip(description, position, ">"))
+            return -1;
+          nodes[node].children.append(element);
+
+          if (keyword == "Map")
+            {
+              const int value_begin = description.indexOf('<', position);
+              if (value_begin == -1)
+                return -1;
+
+              nodes[node].key_value_separator = description.mid(position, value_begin-position);
+              position = value_begin + 1;
+
+              const int value = parse(description, position);
+              if (value == -1 || !skip(description, position, ">"))
+                return -1;
+              nodes[node].children.append(value);
+            }
+        }
+      else if (keyword == "Tuple")
+        {
+          if (!skip(description, position, " of <"))
+            return -1;
+
+          position = description.indexOf('>', position);
+          if (position == -1)
+            return -1;
+          ++position;
+
+          if (!skip(description, position, " elements <"))
+            return -1;
+
+          do
+            {
+              const int part = parse(description, position);
+              if (part == -1 || !skip(description, position, ">"))
+                return -1;
+              nodes[node].children.append(part);
+            }
+          while (skip(description, position, ", <"));
+
+          nodes[node].separator = ":";
+        }
+
+      // the rest of the description up to the closing bracket
+      const int end = (nodes[node].children.isEmpty()
+                       ? description.indexOf(']', position)
+                       : closing_bracket(description, position));
+      if (end == -1)
+        return -1;
+
+      const QString rest = description.mid(position, end-position);
+      position = end + 1;
+
+      Node &n = nodes[node];
+      QString min, max;
+
+      n.description = description.mid(begin, position-begin);
+
+      if (keyword == "List" || keyword == "Map" || keyword == "Tuple")
+        {
+          n.kind = (keyword == "List" ? list : (keyword == "Map" ? map : tuple));
+
+          const int separated_by = rest.indexOf("separated by <");
+          if (separated_by != -1)
+            {
+              const int separator_begin = separated_by + 14;
+              n.separator = rest.mid(separator_begin, rest.lastIndexOf('>')-separator_begin);
+            }
+
+          if (find_range(separated_by != -1 ? rest.left(separated_by) : rest, min, max))
+            {
+              n.min_length = to_integer_bound(min, n.min_length);
+              n.max_length = to_integer_bound(max, n.max_length);
+            }
+        }
+      else if (keyword == "Integer")
+        {
+          n.kind = integer;
+          if (find_range(rest, min, max))
+            {
+              n.min_integer = to_integer_bound(min, n.min_integer);
+              n.max_integer = to_integer_bound(max, n.max_integer);
+            }
+        }
+      else if (keyword == "Double" || keyword == "Float" || keyword == "Floating")
+        {
+          n.kind = floating_point;
+          if (find_range(rest, min, max))
+            {
+              n.min_double = to_double_bound(min, n.min_double);
+              n.max_double = to_double_bound(max, n.max_double);
+            }
+        }
+      else if (keyword == "Selection" || keyword == "MultipleSelection")
+        {
+          n.kind = (keyword == "Selection" ? selection : multiple_selection);
+
+          foreach (const QString &choice, rest.split('|'))
+            n.choice_list.append(choice.trimmed());
+          n.choices = n.choice_list.toSet();
+        }
+      else if (keyword == "Bool")
+        n.kind = boolean;
+      else if (keyword == "Anything")
+        n.kind = anything;
+      else if (keyword == "FileName")
+        n.kind = file_name;
+      else if (keyword == "DirectoryName")
+        n.kind = directory_name;
+      else
+        return -1;
+
+      return node;
+    }
+
+
+
+    PatternValidator PatternValidator::get (const QString &pattern_description)
+    {
+      // the validators of all descriptions ever requested; the number of
+      // distinct descriptions is small compared to the number of parameters
+      static QHash<QString, PatternValidator> validators;
+
+      // files may be checked in several threads at once
+      static QMutex mutex;
+      QMutexLocker lock(&mutex);
+
+      QHash<QString, PatternValidator>::const_iterator
+        p = validators.constFind(pattern_description);
+
+      if (p == validators.constEnd())
+        p = validators.insert(pattern_description, PatternValidator(pattern_description));
+
+      return p.value();
+    }
+
+
+
+    PatternValidator::Kind PatternValidator::kind () const
+    {
+      return nodes.isEmpty() ? unknown : nodes[0].kind;
+    }
+
+
+
+    PatternValidator::Kind PatternValidator::element_kind () const
+    {
+      if (nodes.isEmpty() || (nodes[0].kind != list && nodes[0].kind != map))
+        return unknown;
+
+      return nodes[nodes[0].children[0]].kind;
+    }
+
+
+
+    qint64 PatternValidator::min_integer () const
+    {
+      return nodes.isEmpty() ? Node().min_integer : nodes[0].min_integer;
+    }
+
+
+
+    qint64 PatternValidator::max_integer () const
+    {
+      return nodes.isEmpty() ? Node().max_integer : nodes[0].max_integer;
+    }
+
+
+
+    double PatternValidator::min_double () const
+    {
+      return nodes.isEmpty() ? Node().min_double : nodes[0].min_double;
+    }
+
+
+
+    double PatternValidator::max_double () const
+    {
+      return nodes.isEmpty() ? Node().max_double : nodes[0].max_double;
+    }
+
+
+
+    QStringList PatternValidator::choices () const
+    {
+      return nodes.isEmpty() ? QStringList() : nodes[0].choice_list;
+    }
+
+
+
+    QString PatternValidator::separator () const
+    {
+      return nodes.isEmpty() ? Node().separator : nodes[0].separator;
+    }
+
+
+
+    QString PatternValidator::key_value_separator () const
+    {
+      return nodes.isEmpty() ? Node().key_value_separator : nodes[0].key_value_separator;
+    }
+
+
+
+    QString PatternValidator::element_description () const
+    {
+      if (nodes.isEmpty() || (nodes[0].kind != list && nodes[0].kind != map))
+        return QString();
+
+      return nodes[nodes[0].children[0]].description;
+    }
+
+
+
+    QString PatternValidator::value_description () const
+    {
+      if (nodes.isEmpty() || nodes[0].kind != map)
+        return QString();
+
+      return nodes[nodes[0].children[1]].description;
+    }
+
+
+
+    bool PatternValidator::validate (const QString &value) const
+    {
+      if (nodes.isEmpty())
+        return true;
+
+      return match(0, value.constData(), value.constData() + value.size());
+    }
+
+
+
+    bool PatternValidator::match (const int    node,
+                                  const QChar *begin,
+                                  const QChar *end) const
+    {
+      const Node &n = nodes[node];
+
+      switch (n.kind)
+        {
+          case integer:
+            {
+              trim(begin, end);
+
+              bool ok = false;
+              const qint64 number = QString::fromRawData(begin, end-begin).toLongLong(&ok);
+              return ok && (number >= n.min_integer) && (number <= n.max_integer);
+            }
+
+          case floating_point:
+            {
+              trim(begin, end);
+
+              bool ok = false;
+              const double number = QString::fromRawData(begin, end-begin).toDouble(&ok);
+              return ok && (number >= n.min_double) && (number <= n.max_double);
+            }
+
+          case boolean:
+            {
+              trim(begin, end);
+
+              const QString text = QString::fromRawData(begin, end-begin);
+              return (text == "true") || (text == "false");
+            }
+
+          case selection:
+            trim(begin, end);
+            return n.choices.contains(QString::fromRawData(begin, end-begin));
+
+          case multiple_selection:
+            {
+              for (const QChar *part = begin; ; )
+                {
+                  const QChar *part_end = std::find(part, end, QChar(','));
+
+                  const QChar *choice = part, *choice_end = part_end;
+                  trim(choice, choice_end);
+                  if (choice != choice_end &&
+                      !n.choices.contains(QString::fromRawData(choice, choice_end-choice)))
+                    return false;
+
+                  if (part_end == end)
+                    return true;
+                  part = part_end + 1;
+                }
+            }
+
+          case list:
+          case map:
+          case tuple:
+            {
+              trim(begin, end);
+
+              // an empty value has no elements
+              qint64 count = 0;
+              for (const QChar *element = begin; element != end; ++count)
+                {
+                  const QChar *element_end = find(element, end, n.separator);
+
+                  if (n.kind == list)
+                    {
+                      if (!match(n.children[0], element, element_end))
+                        return false;
+                    }
+                  else if (n.kind == map)
+                    {
+                      const QChar *key_end = find(element, element_end, n.key_value_separator);
+                      if (key_end == element_end ||
+                          !match(n.children[0], element, key_end) ||
+                          !match(n.children[1], key_end + n.key_value_separator.size(), element_end))
+                        return false;
+                    }
+                  else if (count >= n.children.size() ||
+                           !match(n.children[count], element, element_end))
+                    return false;
+
+                  // like in deal.II, a separator at the
+                  // end does not start another element
+                  element = (element_end == end ? end : element_end + n.separator.size());
+                }
+
+              if (n.kind == tuple)
+                return count == n.children.size();
+
+              return (count >= n.min_length) && (count <= n.max_length);
+            }
+
+          default:
+            return true;
+        }
+    }
+  }
+}
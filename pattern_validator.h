@@ -0,0 +1,212 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PATTERNVALIDATOR_H
+#define PATTERNVALIDATOR_H
+
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The PatternValidator class checks values against the <tt>pattern_description</tt>
+     * of a parameter, as written by the @ref ParameterHandler, e.g.
+     * &quot;[List of <[Map of <[Integer]>:<[Double 0...1 (inclusive)]> of length 0...4294967295 (inclusive)]> of length 1...10 (inclusive) separated by <;>]&quot;.
+     * The description is parsed once into a tree of nodes, one for each pattern it is
+     * composed of, including the elements of &quot;List&quot;s, the keys and values of
+     * &quot;Map&quot;s and the parts of &quot;Tuple&quot;s. A value is validated by a
+     * single pass over it, in which composite patterns split their part of the value at
+     * their separators and hand the pieces to the nodes of their elements. No regular
+     * expressions and no copies of the value are involved.
+     *
+     * Validators should be obtained by @ref get, which compiles every distinct description
+     * only once. Copies are cheap, since the nodes are implicitly shared. Descriptions that
+     * are not understood give a validator of kind <tt>unknown</tt> that accepts all values.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class PatternValidator
+    {
+    public:
+      /**
+       * The kinds of patterns of the deal.II Patterns namespace.
+       */
+      enum Kind {unknown = 0, anything, integer, floating_point, boolean, selection,
+                 multiple_selection, file_name, directory_name, list, map, tuple};
+
+      /**
+       * Constructor. Creates a validator of kind <tt>unknown</tt>.
+       */
+      PatternValidator ();
+
+      /**
+       * Return the validator for @p pattern_description. The description is
+       * compiled the first time it is requested, later calls only look it up.
+       * This function is thread-safe.
+       */
+      static PatternValidator get (const QString &pattern_description);
+
+      /**
+       * Return the kind of the outermost pattern.
+       */
+      Kind kind () const;
+
+      /**
+       * Return the kind of the elements of a &quot;List&quot; or of the keys
+       * of a &quot;Map&quot;, or <tt>unknown</tt> for other patterns.
+       */
+      Kind element_kind () const;
+
+      /**
+       * Return the bounds of an outermost &quot;Integer&quot; pattern,
+       * or the range of <tt>int</tt> for other patterns.
+       */
+      qint64 min_integer () const;
+      qint64 max_integer () const;
+
+      /**
+       * Return the bounds of an outermost &quot;Double&quot; pattern,
+       * or the range of <tt>double</tt> for other patterns.
+       */
+      double min_double () const;
+      double max_double () const;
+
+      /**
+       * Return the choices of an outermost &quot;Selection&quot; or &quot;MultipleSelection&quot;
+       * pattern in the order of the description, or an empty list for other patterns.
+       */
+      QStringList choices () const;
+
+      /**
+       * Return the separator between the elements of an outermost &quot;List&quot;
+       * or &quot;Map&quot; pattern, or between the parts of a &quot;Tuple&quot;.
+       */
+      QString separator () const;
+
+      /**
+       * Return the separator between keys and values of an outermost &quot;Map&quot; pattern.
+       */
+      QString key_value_separator () const;
+
+      /**
+       * Return the description of the elements of an outermost &quot;List&quot; or of
+       * the keys of a &quot;Map&quot;, e.g. &quot;[Integer]&quot;, or an empty string.
+       */
+      QString element_description () const;
+
+      /**
+       * Return the description of the values of an outermost &quot;Map&quot;, or an empty string.
+       */
+      QString value_description () const;
+
+      /**
+       * Return whether @p value satisfies the pattern.
+       */
+      bool validate (const QString &value) const;
+
+    private:
+      /**
+       * Constructor. Compile @p pattern_description.
+       */
+      PatternValidator (const QString &pattern_description);
+
+      /**
+       * A pattern in the tree of patterns.
+       */
+      struct Node
+      {
+        Node ();
+
+        /**
+         * The kind of the pattern.
+         */
+        Kind  kind;
+
+        /**
+         * The part of the description this pattern was compiled from.
+         */
+        QString  description;
+
+        /**
+         * The bounds of an &quot;Integer&quot; or a &quot;Double&quot;.
+         */
+        qint64  min_integer, max_integer;
+        double  min_double, max_double;
+
+        /**
+         * The bounds of the number of elements of a &quot;List&quot; or &quot;Map&quot;.
+         */
+        qint64  min_length, max_length;
+
+        /**
+         * The separator between elements, and between keys and values of a &quot;Map&quot;.
+         */
+        QString  separator, key_value_separator;
+
+        /**
+         * The choices of a &quot;Selection&quot; or &quot;MultipleSelection&quot;,
+         * in the order of the description and as a set to look them up.
+         */
+        QStringList    choice_list;
+        QSet<QString>  choices;
+
+        /**
+         * The positions of the nodes of the element of a &quot;List&quot;, the key
+         * and the value of a &quot;Map&quot; or the parts of a &quot;Tuple&quot;.
+         */
+        QVector<int>  children;
+      };
+
+      /**
+       * Append the node of the pattern whose description starts at @p position in
+       * @p description, and the nodes of the patterns it is composed of, to
+       * <tt>nodes</tt>. Return the position of the node, or -1 if the description
+       * is not understood. @p position is moved behind the description.
+       */
+      int parse (const QString &description,
+                 int           &position);
+
+      /**
+       * Return whether the part of a value from @p begin to @p end satisfies the pattern of @p node.
+       */
+      bool match (const int    node,
+                  const QChar *begin,
+                  const QChar *end) const;
+
+      /**
+       * The nodes of the tree, the outermost pattern is the first one.
+       * Empty if the description is not understood.
+       */
+      QVector<Node>  nodes;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,130 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "prm_parameter_reader.h"
+
+#include <QObject>
+#include <QStringList>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    bool PRMParameterReader::read_prm_file(QIODevice *device)
+    {
+      parameter_values.clear();
+      error.clear();
+
+      // the PRMParameterWriter writes Latin-1
+      const QStringList lines = QString::fromLatin1(device->readAll()).split('\n');
+
+      QStringList sections;
+      QString line;
+
+      for (int i = 0; i < lines.size(); ++i)
+        {
+          // join continued lines, the number of the last one is reported in errors
+          QString current = lines[i];
+          if (current.endsWith('\r'))
+            current.chop(1);
+
+          if (current.endsWith('\\'))
+            {
+              current.chop(1);
+              line += current;
+              if (i+1 < lines.size())
+                continue;
+            }
+          else
+            line += current;
+
+          // strip comments, an escaped "\#" is a literal "#"
+          for (int c = 0; c < line.size(); ++c)
+            if (line[c] == '#' && (c == 0 || line[c-1] != '\\'))
+              {
+                line.truncate(c);
+                break;
+              }
+          line.replace("\\#", "#");
+
+          const QString statement = line.trimmed();
+          line.clear();
+
+          if (statement.isEmpty())
+            continue;
+
+          if (statement.startsWith("subsection "))
+            sections.append(statement.mid(11).trimmed());
+          else if (statement == "end")
+            {
+              if (sections.isEmpty())
+                {
+                  error = QObject::tr("Line %1: end without a subsection.").arg(i+1);
+                  return false;
+                }
+
+              sections.removeLast();
+            }
+          else if (statement.startsWith("set "))
+            {
+              const int separator = statement.indexOf('=');
+              if (separator == -1)
+                {
+                  error = QObject::tr("Line %1: set without a value.").arg(i+1);
+                  return false;
+                }
+
+              QStringList path = sections;
+              path.append(statement.mid(4, separator-4).trimmed());
+
+              parameter_values.insert(path.join("/"), statement.mid(separator+1).trimmed());
+            }
+          else if (statement.startsWith("include "))
+            {
+              error = QObject::tr("Line %1: include statements are not supported.").arg(i+1);
+              return false;
+            }
+          else
+            {
+              error = QObject::tr("Line %1: invalid line \"%2\".").arg(i+1).arg(statement);
+              return false;
+            }
+        }
+
+      if (!sections.isEmpty())
+        {
+          error = QObject::tr("The subsection %1 is not closed.").arg(sections.join("/"));
+          return false;
+        }
+
+      return true;
+    }
+
+
+
+    QHash<QString, QString> PRMParameterReader::values() const
+    {
+      return parameter_values;
+    }
+
+
+
+    QString PRMParameterReader::error_string() const
+    {
+      return error;
+    }
+  }
+}
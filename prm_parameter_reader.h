@@ -0,0 +1,86 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef PRMPARAMETERREADER_H
+#define PRMPARAMETERREADER_H
+
+#include <QHash>
+#include <QIODevice>
+#include <QString>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The PRMParameterReader class reads the values set in a parameter file in deal.II's
+     * PRM format, as written by the @ref PRMParameterWriter. A PRM file only contains the
+     * values of the parameters, not their defaults, patterns and documentation, so it
+     * can not be shown on its own. Instead the values are returned by the paths of the
+     * parameters, the names of the subsections and the parameter separated by
+     * &quot;/&quot; as shown in the parameterGUI, and applied to a tree read from an
+     * XML file.
+     *
+     * The reader follows the syntax of the @ref ParameterHandler: comments start with
+     * &quot;#&quot;, lines ending with &quot;\&quot; are continued on the next line,
+     * and if a parameter is set more than once the last value counts.
+     * <tt>include</tt> statements are not supported.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class PRMParameterReader
+    {
+    public:
+      /**
+       * Read the parameter file in PRM format from @p device.
+       * Returns false if the file has a syntax error.
+       */
+      bool read_prm_file (QIODevice *device);
+
+      /**
+       * Return the values of the parameters set in the file by their paths.
+       */
+      QHash<QString, QString> values () const;
+
+      /**
+       * This function returns an error message.
+       */
+      QString error_string () const;
+
+    private:
+      /**
+       * The values of the parameters by their paths.
+       */
+      QHash<QString, QString> parameter_values;
+
+      /**
+       * The message of the last error.
+       */
+      QString error;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -15,13 +15,15 @@
 
 
 #include "prm_parameter_writer.h"
+#include "parameter_item.h"
 
 namespace dealii
 {
   namespace ParameterGui
   {
     PRMParameterWriter::PRMParameterWriter(QTreeWidget *tree_widget)
-                      : tree_widget(tree_widget)
+                      : tree_widget(tree_widget),
+                        written_items(0)
     {
     }
 
@@ -41,6 +43,60 @@ namespace dealii
 
 
 
+    bool PRMParameterWriter::write_prm_file(QIODevice                           *device,
+                                            const QSet<const QTreeWidgetItem *> &items)
+    {
+      written_items = &items;
+      const bool written = write_prm_file(device);
+      written_items = 0;
+
+      return written;
+    }
+
+
+
+    QString PRMParameterWriter::set_line (const QString      &name,
+                                          const QString      &value,
+                                          const unsigned int  indentation_level)
+    {
+      QString line;
+      for (unsigned int i=0; i<indentation_level;++i)
+        line.push_back("  ");
+
+      line.push_back("set " + name + " = " + value + "\n");
+
+      return line;
+    }
+
+
+
+    QString PRMParameterWriter::subsection_line (const QString      &name,
+                                                 const unsigned int  indentation_level)
+    {
+      QString line;
+      for (unsigned int i=0; i<indentation_level;++i)
+        line.push_back("  ");
+
+      line.push_back("subsection " + name.toLatin1() + "\n");
+
+      return line;
+    }
+
+
+
+    QString PRMParameterWriter::end_line (const unsigned int indentation_level)
+    {
+      QString line;
+      for (unsigned int i=0; i<indentation_level;++i)
+        line.push_back("  ");
+
+      line.push_back("end\n\n");
+
+      return line;
+    }
+
+
+
     QString PRMParameterWriter::item_to_string(const QTreeWidgetItem *item,
                                                const unsigned int indentation_level)
     {
@@ -49,21 +105,12 @@ namespace dealii
       // if the entry has no children we have a parameter
       if (item->childCount() == 0)
         {
-          bool non_default_value;
-
-          if (item->text(5).startsWith("[Double"))
-            non_default_value = item->data(1,Qt::DisplayRole).toReal() != item->data(2,Qt::DisplayRole).toReal();
-          else
-            non_default_value = item->data(1,Qt::DisplayRole).toString() != item->data(2,Qt::DisplayRole).toString();
-
-
-          if (non_default_value)
-            {
-              for (unsigned int i=0; i<indentation_level;++i)
-                item_string.push_back("  ");
-
-              item_string.push_back("set " + item->text(0) + " = " + item->data(1,Qt::EditRole).toString() + "\n");
-            }
+          if (written_items
+              ? written_items->contains(item)
+              : !ParameterItem::has_default_value(item))
+            item_string = set_line(item->text(0),
+                                   item->data(1,Qt::EditRole).toString(),
+                                   indentation_level);
         }
       else
         {
@@ -71,16 +118,9 @@ namespace dealii
             item_string.push_back(item_to_string(item->child(i),indentation_level+1));
 
           if (!item_string.isEmpty())
-            {
-              item_string.push_front("subsection " + item->text(0).toLatin1() + "\n");
-              for (unsigned int i=0; i<indentation_level;++i)
-                item_string.push_front("  ");
-
-
-              for (unsigned int i=0; i<indentation_level;++i)
-                item_string.push_back("  ");
-              item_string.push_back("end\n\n");
-            }
+            item_string = subsection_line(item->text(0), indentation_level)
+                          + item_string
+                          + end_line(indentation_level);
         }
 
       return item_string;
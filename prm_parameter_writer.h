@@ -17,6 +17,7 @@
 #ifndef PRMPARAMETERWRITER_H
 #define PRMPARAMETERWRITER_H
 
+#include <QSet>
 #include <QTreeWidget>
 #include <QTreeWidgetItem>
 
@@ -57,6 +58,32 @@ namespace dealii
        */
       bool write_prm_file (QIODevice *device);
 
+      /**
+       * This function writes the values of the parameters in @p items to @p device
+       * in the PRM format, whether or not they have their default values.
+       */
+      bool write_prm_file (QIODevice                           *device,
+                           const QSet<const QTreeWidgetItem *> &items);
+
+      /**
+       * Return the line that sets the parameter @p name to @p value
+       * in a subsection at @p indentation_level.
+       */
+      static QString set_line (const QString      &name,
+                               const QString      &value,
+                               const unsigned int  indentation_level);
+
+      /**
+       * Return the line that opens the subsection @p name at @p indentation_level.
+       */
+      static QString subsection_line (const QString      &name,
+                                      const unsigned int  indentation_level);
+
+      /**
+       * Return the lines that close a subsection at @p indentation_level.
+       */
+      static QString end_line (const unsigned int indentation_level);
+
     private:
       /**
        * This function creates a string that corresponds to the data written
@@ -80,6 +107,12 @@ namespace dealii
        * which stores the parameters.
        */
       QTreeWidget *tree_widget;
+
+      /**
+       * The parameters to write, or 0 if all parameters that do not have
+       * their default values are written.
+       */
+      const QSet<const QTreeWidgetItem *> *written_items;
     };
   }
   /**@}*/
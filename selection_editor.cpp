@@ -0,0 +1,300 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#include "selection_editor.h"
+
+#include <QAbstractItemView>
+#include <QAbstractListModel>
+#include <QHBoxLayout>
+#include <QValidator>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace
+    {
+      // the number of rows the popup creates at once when it is scrolled
+      const int rows_per_fetch = 100;
+    }
+
+
+
+    /**
+     * The model of the popup. It shows a range of the choices of a pattern,
+     * either in their original order or in the order of the index of the
+     * pattern, and creates the rows only when the popup is scrolled to them.
+     */
+    class SelectionEditor::ChoiceModel : public QAbstractListModel
+    {
+    public:
+      ChoiceModel (QObject *parent)
+        : QAbstractListModel(parent),
+          sorted(false),
+          begin(0),
+          end(0),
+          fetched(0)
+      {
+      }
+
+      void set_pattern (const ParameterPattern &new_pattern)
+      {
+        pattern = new_pattern;
+        show_rows(false, 0, 0);
+      }
+
+      void show_all ()
+      {
+        show_rows(false, 0, pattern.choices.size());
+      }
+
+      void show_beginning_with (const QString &prefix)
+      {
+        int first, last;
+        pattern.find_choices(prefix, first, last);
+        show_rows(true, first, last);
+      }
+
+      int rowCount (const QModelIndex &parent = QModelIndex()) const
+      {
+        return parent.isValid() ? 0 : fetched;
+      }
+
+      QVariant data (const QModelIndex &index, int role) const
+      {
+        if (!index.isValid() || (role != Qt::DisplayRole && role != Qt::EditRole))
+          return QVariant();
+
+        const int position = (sorted
+                              ? pattern.sorted_choices[begin + index.row()]
+                              : begin + index.row());
+        return pattern.choices[position];
+      }
+
+      bool canFetchMore (const QModelIndex &parent) const
+      {
+        return !parent.isValid() && (fetched < end - begin);
+      }
+
+      void fetchMore (const QModelIndex &parent)
+      {
+        if (parent.isValid())
+          return;
+
+        const int rows = qMin(rows_per_fetch, end - begin - fetched);
+        if (rows <= 0)
+          return;
+
+        beginInsertRows(QModelIndex(), fetched, fetched + rows - 1);
+        fetched += rows;
+        endInsertRows();
+      }
+
+    private:
+      void show_rows (const bool sorted_rows,
+                      const int  first,
+                      const int  last)
+      {
+        beginResetModel();
+        sorted = sorted_rows;
+        begin = first;
+        end = last;
+        fetched = qMin(rows_per_fetch, end - begin);
+        endResetModel();
+      }
+
+      ParameterPattern pattern;
+
+      // whether the rows are positions in pattern.sorted_choices
+      // or in pattern.choices
+      bool sorted;
+
+      // the range of positions that is shown,
+      // and the number of rows created so far
+      int begin, end, fetched;
+    };
+
+
+
+    /**
+     * The validator of the line editor. It accepts the choices
+     * and considers their beginnings as intermediate input.
+     */
+    class SelectionEditor::ChoiceValidator : public QValidator
+    {
+    public:
+      ChoiceValidator (QObject *parent)
+        : QValidator(parent)
+      {
+      }
+
+      void set_pattern (const ParameterPattern &new_pattern)
+      {
+        pattern = new_pattern;
+      }
+
+      State validate (QString &input, int &) const
+      {
+        if (pattern.choice_positions.contains(input))
+          return Acceptable;
+
+        int begin, end;
+        pattern.find_choices(input, begin, end);
+        return (begin < end) ? Intermediate : Invalid;
+      }
+
+      void fixup (QString &input) const
+      {
+        int begin, end;
+        pattern.find_choices(input, begin, end);
+
+        // a choice equal to the input ignoring case comes first
+        if (begin < end &&
+            (end - begin == 1 ||
+             pattern.choices[pattern.sorted_choices[begin]].compare(input, Qt::CaseInsensitive) == 0))
+          input = pattern.choices[pattern.sorted_choices[begin]];
+      }
+
+    private:
+      ParameterPattern pattern;
+    };
+
+
+
+    SelectionEditor::SelectionEditor(QWidget *parent)
+                   : QFrame(parent, 0)
+    {
+      line_editor = new QLineEdit;
+      connect(line_editor, SIGNAL(editingFinished()), this, SLOT(editing_finished()));
+      connect(line_editor, SIGNAL(textEdited(const QString &)), this, SLOT(update_choices(const QString &)));
+
+      validator = new ChoiceValidator(this);
+      line_editor->setValidator(validator);
+
+      choice_model = new ChoiceModel(this);
+      completer = new QCompleter(choice_model, this);
+      completer->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+      completer->setMaxVisibleItems(20);
+      line_editor->setCompleter(completer);
+      connect(completer, SIGNAL(activated(const QString &)), this, SLOT(choice_selected(const QString &)));
+
+      show_button = new QToolButton;
+      show_button->setArrowType(Qt::DownArrow);
+      connect(show_button, SIGNAL(clicked()), this, SLOT(show_all_choices()));
+
+      setFocusPolicy (Qt::StrongFocus);
+      setFocusProxy(line_editor);
+
+      QHBoxLayout *layout = new QHBoxLayout;
+
+      layout->setContentsMargins(1,1,1,1);
+      layout->addWidget(line_editor);
+      layout->addWidget(show_button);
+      setLayout(layout);
+
+      setAutoFillBackground(true);
+      setBackgroundRole(QPalette::Highlight);
+    }
+
+
+
+    QSize SelectionEditor::sizeHint() const
+    {
+      QSize  size_line_editor = line_editor->sizeHint(),
+             size_show_button = show_button->sizeHint();
+
+      int w = size_line_editor.rwidth() + size_show_button.rwidth(),
+          h = qMax(size_line_editor.rheight(), size_show_button.rheight());
+
+      return QSize (w, h);
+    }
+
+
+
+    QSize SelectionEditor::minimumSizeHint() const
+    {
+      QSize  size_line_editor = line_editor->minimumSizeHint(),
+             size_show_button = show_button->minimumSizeHint();
+
+      int w = size_line_editor.rwidth() + size_show_button.rwidth(),
+          h = qMax(size_line_editor.rheight(), size_show_button.rheight());
+
+      return QSize (w, h);
+    }
+
+
+
+    void SelectionEditor::set_pattern(const ParameterPattern &new_pattern)
+    {
+      pattern = new_pattern;
+      validator->set_pattern(pattern);
+      choice_model->set_pattern(pattern);
+    }
+
+
+
+    QString SelectionEditor::text() const
+    {
+      return line_editor->text();
+    }
+
+
+
+    void SelectionEditor::setText(const QString &str)
+    {
+      line_editor->setText(str);
+    }
+
+
+
+    void SelectionEditor::update_choices(const QString &text)
+    {
+      if (text.isEmpty())
+        choice_model->show_all();
+      else
+        choice_model->show_beginning_with(text);
+
+      completer->setCompletionPrefix(text);
+      completer->complete();
+    }
+
+
+
+    void SelectionEditor::show_all_choices()
+    {
+      choice_model->show_all();
+
+      line_editor->setFocus();
+      completer->setCompletionPrefix(QString());
+      completer->complete();
+    }
+
+
+
+    void SelectionEditor::choice_selected(const QString &choice)
+    {
+      line_editor->setText(choice);
+      emit editingFinished();
+    }
+
+
+
+    void SelectionEditor::editing_finished()
+    {
+      emit editingFinished();
+    }
+  }
+}
@@ -0,0 +1,160 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+#ifndef SELECTIONEDITOR_H
+#define SELECTIONEDITOR_H
+
+#include <QCompleter>
+#include <QFrame>
+#include <QLineEdit>
+#include <QToolButton>
+
+#include "parameter_pattern.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The SelectionEditor class provides the editor for &quot;Selection&quot; parameters.
+     * Some selections offer thousands of choices, which a combo box would have to add
+     * one by one every time it is opened. This editor instead consists of a line editor,
+     * in which the user types the beginning of a choice, and a button that shows all
+     * choices. The choices beginning with the typed text, ignoring case, are found by a
+     * binary search in the index of the ParameterPattern and shown in a popup, which
+     * only creates the rows that are scrolled into view. Opening the editor and typing
+     * therefore takes a time proportional to the number of visible choices.
+     *
+     * Only the beginnings of choices can be typed. If editing is finished with a text
+     * that is the beginning of a single choice, or equal to a choice ignoring case,
+     * it is completed to this choice.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class SelectionEditor : public QFrame
+    {
+      Q_OBJECT
+
+    public:
+      /**
+       * Constructor.
+       */
+      SelectionEditor (QWidget *parent = 0);
+
+      /**
+       * Reimplemented from the QWidget class.
+       * Returns the size of the editor.
+       */
+      QSize  sizeHint() const;
+
+      /**
+       * Reimplemented from the QWidget class.
+       */
+      QSize  minimumSizeHint() const;
+
+      /**
+       * Offer the choices of @p pattern. This is cheap, the
+       * editor does not copy the choices.
+       */
+      void set_pattern (const ParameterPattern &pattern);
+
+      /**
+       * Returns the text of the line editor.
+       */
+      QString  text() const;
+
+    public slots:
+      /**
+       * A <tt>slot</tt> to set @p str as text of the line editor.
+       */
+      void setText(const QString &str);
+
+    signals:
+      /**
+       * This <tt>signal</tt> will be emitted, if editing is finished
+       * or a choice is selected in the popup.
+       */
+      void editingFinished();
+
+    private slots:
+      /**
+       * Show the choices beginning with @p text.
+       * This <tt>slot</tt> is called whenever the text is edited.
+       */
+      void update_choices(const QString &text);
+
+      /**
+       * Show all choices in their original order.
+       */
+      void show_all_choices();
+
+      /**
+       * Take the @p choice selected in the popup.
+       */
+      void choice_selected(const QString &choice);
+
+      /**
+       * This <tt>slot</tt> should be always called, if editing is finished.
+       */
+      void editing_finished();
+
+    private:
+      class ChoiceModel;
+      class ChoiceValidator;
+
+      /**
+       * The pattern whose choices are offered.
+       */
+      ParameterPattern pattern;
+
+      /**
+       * The line editor.
+       */
+      QLineEdit *line_editor;
+
+      /**
+       * The button that shows all choices.
+       */
+      QToolButton *show_button;
+
+      /**
+       * The completer that shows the choices in a popup.
+       */
+      QCompleter *completer;
+
+      /**
+       * The model of the popup, which contains the choices that are shown.
+       */
+      ChoiceModel *choice_model;
+
+      /**
+       * The validator of the line editor, which accepts the beginnings of choices.
+       */
+      ChoiceValidator *validator;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -48,6 +48,12 @@ namespace dealii
       connect(hide_default, SIGNAL(stateChanged(int)), this, SLOT(changeHideDefault(int)));
       grid->addRow("Hide default values",hide_default);
 
+      // add a checkbox for the view mode
+      large_files = new QCheckBox(this);
+      large_files->setChecked(large_file_mode);
+      connect(large_files, SIGNAL(stateChanged(int)), this, SLOT(changeLargeFileMode(int)));
+      grid->addRow("Optimize for large files",large_files);
+
       // add an OK button
       ok = new QPushButton(this);
       ok->setText(QErrorMessage::tr("&OK"));
@@ -83,10 +89,18 @@ namespace dealii
 
 
 
+    void SettingsDialog::changeLargeFileMode(int state)
+    {
+      large_file_mode = state;
+    }
+
+
+
     void SettingsDialog::loadSettings()
     {
       settings->beginGroup("Settings");
       hide_default_values = settings->value("hideDefault", false).toBool();
+      large_file_mode = settings->value("largeFileMode", false).toBool();
 
       QString stored_font_string = settings->value("Font", QFont().toString()).toString();
       selected_font.fromString(stored_font_string);
@@ -100,6 +114,7 @@ namespace dealii
       settings->beginGroup("Settings");
 
       settings->setValue("hideDefault", hide_default_values);
+      settings->setValue("largeFileMode", large_file_mode);
       settings->setValue("Font", selected_font.toString());
 
       settings->endGroup();
@@ -60,6 +60,11 @@ namespace dealii
        */
       void changeHideDefault(int state);
 
+      /**
+       * Function that stores the checked state of the "Optimize for large files" checkbox.
+       */
+      void changeLargeFileMode(int state);
+
       /**
        * Function that stores the new settings in the settings object
        * (i.e. on disk).
@@ -80,6 +85,13 @@ namespace dealii
        */
       bool hide_default_values;
 
+      /**
+       * This variable stores if the view should be optimized for large files.
+       * As for <tt>hide_default_values</tt>, this is the current state of
+       * the checkbox.
+       */
+      bool large_file_mode;
+
       /**
        * The selected font as shown in the Change Font dialog.
        */
@@ -105,6 +117,11 @@ namespace dealii
        */
       QCheckBox *hide_default;
 
+      /**
+       * The checkbox<tt>Optimize for large files</tt>.
+       */
+      QCheckBox *large_files;
+
       /**
        * An object for storing <tt>settings</tt> in a file.
        */
@@ -0,0 +1,65 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#include "string_pool.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    namespace StringPool
+    {
+      namespace
+      {
+        QMutex         mutex;
+        QSet<QString>  strings;
+      }
+
+
+
+      QString shared (const QString &s)
+      {
+        QMutexLocker lock(&mutex);
+
+        QSet<QString>::const_iterator p = strings.constFind(s);
+        if (p != strings.constEnd())
+          return *p;
+
+        strings.insert(s);
+        return s;
+      }
+
+
+
+      void release_unused ()
+      {
+        QMutexLocker lock(&mutex);
+
+        // a string whose data is not shared is only used by the pool
+        for (QSet<QString>::iterator p = strings.begin(); p != strings.end(); )
+          if (p->isDetached())
+            p = strings.erase(p);
+          else
+            ++p;
+      }
+    }
+  }
+}
@@ -0,0 +1,66 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <QString>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * A pool of strings shared by all parameter files opened by the parameterGUI.
+     * Files created from the same ParameterHandler declaration contain the same names,
+     * documentation, patterns and default values. Storing the copy returned by
+     * @ref shared instead of the string read from a file lets all of them use the same
+     * implicitly shared data, so the schema of the parameters is held in memory once,
+     * no matter how many windows show files with it. Only the schema is stored in the
+     * pool, never the values of parameters, which differ from file to file. Strings
+     * that are no longer used outside of the pool are removed by @ref release_unused,
+     * which should be called whenever the parameters of a file are deleted.
+     * All functions are thread-safe.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    namespace StringPool
+    {
+      /**
+       * Return a copy of @p s that shares its data with the string in the pool.
+       */
+      QString shared (const QString &s);
+
+      /**
+       * Remove the strings from the pool that are not used anywhere else,
+       * e.g. after the last window showing files with a schema was closed.
+       */
+      void release_unused ();
+    }
+  }
+  /**@}*/
+}
+
+
+#endif
@@ -0,0 +1,136 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#include "xml_parameter_override.h"
+#include "xml_parameter_writer.h"
+
+#include <QObject>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    XMLParameterOverride::XMLParameterOverride(const QHash<QString, QString> &overrides)
+    {
+      for (QHash<QString, QString>::const_iterator p = overrides.constBegin();
+           p != overrides.constEnd(); ++p)
+        {
+          QStringList names = p.key().split('/');
+          for (int i = 0; i < names.size(); ++i)
+            names[i] = XMLParameterWriter::mangle(names[i]);
+
+          const QString path = names.join("/");
+          values.insert(path, p.value());
+          paths.insert(path, p.key());
+        }
+    }
+
+
+
+    bool XMLParameterOverride::apply(QIODevice *input,
+                                     QIODevice *output)
+    {
+      reader.setDevice(input);
+      writer.setDevice(output);
+
+      elements.clear();
+      matched.clear();
+
+      while (!reader.atEnd())
+        {
+          reader.readNext();
+
+          if (reader.hasError())
+            break;
+
+          if (reader.isStartElement())
+            {
+              elements.append(reader.name().toString());
+
+              // the <value> element of a parameter that is overridden
+              if (reader.name() == "value")
+                {
+                  const QString path = current_path();
+                  QHash<QString, QString>::const_iterator value = values.constFind(path);
+
+                  if (value != values.constEnd())
+                    {
+                      writer.writeCurrentToken(reader);
+                      writer.writeCharacters(value.value());
+
+                      // skip the old value up to and including </value>
+                      reader.readElementText();
+                      writer.writeEndElement();
+                      elements.removeLast();
+
+                      matched.insert(path);
+                      continue;
+                    }
+                }
+            }
+          else if (reader.isEndElement())
+            elements.removeLast();
+
+          writer.writeCurrentToken(reader);
+        }
+
+      return !reader.hasError();
+    }
+
+
+
+    QString XMLParameterOverride::error_string() const
+    {
+      return QObject::tr("%1\nLine %2, column %3")
+             .arg(reader.errorString())
+             .arg(reader.lineNumber())
+             .arg(reader.columnNumber());
+    }
+
+
+
+    QStringList XMLParameterOverride::unmatched_paths() const
+    {
+      QStringList result;
+
+      for (QHash<QString, QString>::const_iterator p = paths.constBegin(); p != paths.constEnd(); ++p)
+        if (!matched.contains(p.key()))
+          result.append(p.value());
+
+      result.sort();
+      return result;
+    }
+
+
+
+    QString XMLParameterOverride::current_path() const
+    {
+      // the elements are <ParameterHandler>, the subsections,
+      // the parameter and its <value>
+      QString path;
+
+      for (int i = 1; i < elements.size()-1; ++i)
+        {
+          if (i > 1)
+            path.append('/');
+          path.append(elements[i]);
+        }
+
+      return path;
+    }
+  }
+}
@@ -0,0 +1,123 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#ifndef XMLPARAMETEROVERRIDE_H
+#define XMLPARAMETEROVERRIDE_H
+
+#include <QHash>
+#include <QIODevice>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The XMLParameterOverride class copies a parameter file in XML format and replaces
+     * the values of some parameters on the way. It reads the file with a QXmlStreamReader
+     * and writes every token unchanged with a QXmlStreamWriter, except for the
+     * <code>&lt;value&gt;</code> elements of the parameters to override. The file is
+     * never loaded as a whole, so the memory needed only depends on the depth of the
+     * subsections and the file can be processed about as fast as it can be read.
+     *
+     * Parameters are given by their path, the names of the subsections and the
+     * parameter separated by &quot;/&quot; as shown in the parameterGUI, e.g.
+     * <tt>Solver/Tolerance</tt>. The paths are mangled once with
+     * XMLParameterWriter::mangle and then compared to the element names in the file.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class XMLParameterOverride
+    {
+    public:
+      /**
+       * Constructor. @p overrides are the new values by the paths of the parameters.
+       */
+      XMLParameterOverride (const QHash<QString, QString> &overrides);
+
+      /**
+       * Copy the parameter file from @p input to @p output and replace the
+       * values of the parameters to override. Returns false if @p input is
+       * not a valid XML file.
+       */
+      bool apply (QIODevice *input,
+                  QIODevice *output);
+
+      /**
+       * This function returns an error message.
+       */
+      QString error_string () const;
+
+      /**
+       * Return the paths of the parameters to override that were not found in the file.
+       */
+      QStringList unmatched_paths () const;
+
+    private:
+      /**
+       * Return the path of the parameter whose <code>&lt;value&gt;</code>
+       * element the reader is in, with mangled names.
+       */
+      QString current_path () const;
+
+      /**
+       * The QXmlStreamReader object for reading the file.
+       */
+      QXmlStreamReader  reader;
+
+      /**
+       * The QXmlStreamWriter object for writing the copy.
+       */
+      QXmlStreamWriter  writer;
+
+      /**
+       * The new values by the mangled paths of the parameters.
+       */
+      QHash<QString, QString> values;
+
+      /**
+       * The paths the user gave by their mangled paths.
+       */
+      QHash<QString, QString> paths;
+
+      /**
+       * The names of the elements the reader is in.
+       */
+      QStringList elements;
+
+      /**
+       * The mangled paths of the parameters that were overridden.
+       */
+      QSet<QString> matched;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif
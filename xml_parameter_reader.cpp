@@ -15,6 +15,9 @@
 
 
 #include "xml_parameter_reader.h"
+#include "parameter_item.h"
+#include "pattern_validator.h"
+#include "string_pool.h"
 
 namespace dealii
 {
@@ -130,7 +133,7 @@ namespace dealii
       QTreeWidgetItem * subsection = create_child_item(parent);
 
       subsection->setIcon(0, subsection_icon);
-      subsection->setText(0, demangle(xml.name().toString()));
+      subsection->setText(0, StringPool::shared(demangle(xml.name().toString())));
 
       // the folder is not expanded
       tree_widget->setItemExpanded(subsection, 0);
@@ -184,102 +187,60 @@ namespace dealii
               // if it is <default_value> store it
               if (xml.isStartElement() && xml.name() == "default_value")
                 {
-                  QString default_value = xml.readElementText();
+                  QString default_value = StringPool::shared(xml.readElementText());
                   parent->setText(2, default_value);
                 }
               // if it is <documentation> store it
               else if (xml.isStartElement() && xml.name() == "documentation")
                 {
-                  QString documentation = xml.readElementText();
+                  QString documentation = StringPool::shared(xml.readElementText());
                   parent->setText(3, documentation);
                 }
               // if it is <pattern> store it as text,
               // we only need this value for writing back to XML later
               else if (xml.isStartElement() && xml.name() == "pattern")
                 {
-                  QString pattern = xml.readElementText();
+                  QString pattern = StringPool::shared(xml.readElementText());
                   parent->setText(4, pattern);
                 }
               // if it is <pattern_description> store it as text
               else if (xml.isStartElement() &&  xml.name() == "pattern_description")
                 {
-                  QString pattern_description = xml.readElementText();
+                  QString pattern_description = StringPool::shared(xml.readElementText());
 
                   // show the type and default
                   // in the StatusLine when
                   // hovering over column 0 or 1
-                  parent->setText(5, pattern_description);
-                  parent->setStatusTip(0, "Type: " + pattern_description + "   Default: " + parent->text(2));
-                  parent->setStatusTip(1, "Type: " + pattern_description + "   Default: " + parent->text(2));
-
-                  // in order to store values as correct data types,
-                  // we check the following types in the pattern_description:
-                  QRegExp  rx_string("\\b(Anything|FileName|DirectoryName|Selection|List|MultipleSelection)\\b"),	
-                           rx_integer("\\b(Integer)\\b"),
-                           rx_double("\\b(Float|Floating|Double)\\b"),
-                           rx_bool("\\b(Bool)\\b");
-
-                  // store the type "Anything" or "Filename" as a QString
-                  if (rx_string.indexIn (pattern_description) != -1)
-                    {
-                      QString value = parent->text(1);
-
-                      parent->setData(1, Qt::EditRole, value);
-                      parent->setData(1, Qt::DisplayRole, value);
-                    }
-                  // store the type "Integer" as an int
-                  else if (rx_integer.indexIn (pattern_description) != -1)
-                    {
-                      QString text = parent->text(1);
-
-                      bool ok = true;
-                      int value = text.toInt(&ok);
-
-                      if (ok)
-                        {
-                          parent->setData(1, Qt::EditRole, value);
-                          parent->setData(1, Qt::DisplayRole, value);
-                        }
-                      else
-                        xml.raiseError(QObject::tr("Cannot convert integer type to integer!"));
-                    }
-                  // store the type "Double" as an double
-                  else if (rx_double.indexIn (pattern_description) != -1)
-                    {
-                      QString text = parent->text(1);
+                  // the texts read from the file are shared with all other files with
+                  // the same parameters, see StringPool
+                  const QString status_tip
+                    = StringPool::shared("Type: " + pattern_description + "   Default: " + parent->text(2));
 
-                      bool ok  = true;
+                  parent->setText(5, pattern_description);
+                  parent->setStatusTip(0, status_tip);
+                  parent->setStatusTip(1, status_tip);
 
-                      double value = text.toDouble(&ok);
+                  // the delegate needs the pattern to choose an editor, but
+                  // column 5 is not accessible through the model
+                  parent->setData(1, ParameterItem::pattern_description_role, pattern_description);
 
-                      if (ok)
-                        {
-                          parent->setData(1, Qt::EditRole, value);
-                          parent->setData(1, Qt::DisplayRole, value);
-                        }
-                      else
-                        xml.raiseError(QObject::tr("Cannot convert double type to double!"));
-                    }
+                  // store the value with the correct data type
+                  QString error;
+                  const QVariant value = typed_value(parent->text(1),
+                                                     value_type(pattern_description),
+                                                     error);
+                  if (!error.isEmpty())
+                    xml.raiseError(error);
 
-                  // store the type "Bool" as an boolean
-                  if (rx_bool.indexIn (pattern_description) != -1)
-                    {
-                      QRegExp  test(parent->text(1));
+                  // this is needed because we use for booleans the standard delegate
+                  if (value.type() == QVariant::Bool)
+                    parent->setText(1, "");
 
-                      bool value = true;
+                  parent->setData(1, Qt::EditRole, value);
+                  parent->setData(1, Qt::DisplayRole, value);
 
-                      if (test.exactMatch("true"))
-                        value = true;
-                      else if (test.exactMatch("false"))
-                        value = false;
-                      else
-                        xml.raiseError(QObject::tr("Cannot convert boolean type to boolean!"));
-
-                      // this is needed because we use for booleans the standard delegate
-                      parent->setText(1, "");
-                      parent->setData(1, Qt::EditRole, value);
-                      parent->setData(1, Qt::DisplayRole, value);
-                    }
+                  // remember the default value and the value as read from the file
+                  ParameterItem::store_reference_values(parent);
 
                   break;
                 }
@@ -295,6 +256,165 @@ namespace dealii
 
 
 
+    bool XMLParameterReader::read_parameters (QIODevice            *device,
+                                              QVector<Parameter>   &parameters,
+                                              QString              &error)
+    {
+      QXmlStreamReader xml(device);
+
+      // look for the root element <ParameterHandler>
+      while (xml.readNext() != QXmlStreamReader::Invalid)
+        if (xml.isStartElement())
+          break;
+
+      if (!xml.isStartElement() || xml.name() != "ParameterHandler")
+        {
+          if (!xml.hasError())
+            xml.raiseError(QObject::tr("The file is not an ParameterHandler XML file."));
+        }
+      else
+        {
+          QStringList names;
+
+          while (xml.readNext() != QXmlStreamReader::Invalid)
+            {
+              if (xml.isEndElement())
+                {
+                  // the closing </ParameterHandler>
+                  if (names.isEmpty())
+                    break;
+
+                  names.removeLast();
+                }
+              else if (xml.isStartElement())
+                {
+                  if (xml.name() == "value" && !names.isEmpty())
+                    {
+                      Parameter parameter;
+                      parameter.path = names.join("/");
+                      parameter.value = xml.readElementText();
+
+                      // the end element of the parameter is handled above
+                      while (xml.readNext() != QXmlStreamReader::Invalid)
+                        if (xml.isStartElement())
+                          {
+                            if (xml.name() == "default_value" ||
+                                xml.name() == "documentation" ||
+                                xml.name() == "pattern")
+                              xml.skipCurrentElement();
+                            else if (xml.name() == "pattern_description")
+                              {
+                                parameter.pattern_description = xml.readElementText();
+                                break;
+                              }
+                            else
+                              {
+                                xml.raiseError(QObject::tr("Incomplete or unknown Parameter!"));
+                                break;
+                              }
+                          }
+
+                      parameters.append(parameter);
+                    }
+                  else
+                    names.append(demangle(xml.name().toString()));
+                }
+            }
+        }
+
+      if (xml.hasError())
+        {
+          error = QObject::tr("%1\nLine %2, column %3")
+                  .arg(xml.errorString())
+                  .arg(xml.lineNumber())
+                  .arg(xml.columnNumber());
+          return false;
+        }
+
+      return true;
+    }
+
+
+
+    XMLParameterReader::ValueType
+    XMLParameterReader::value_type (const QString &pattern_description)
+    {
+      // in order to store values as correct data types, we check the outermost
+      // pattern: a "Map" of "Integer"s or a "Tuple" of "Double"s is text
+      switch (PatternValidator::get(pattern_description).kind())
+        {
+          case PatternValidator::integer:
+            return integer_value;
+
+          case PatternValidator::floating_point:
+            return double_value;
+
+          case PatternValidator::boolean:
+            return boolean_value;
+
+          default:
+            return string_value;
+        }
+    }
+
+
+
+    QVariant XMLParameterReader::typed_value (const QString   &text,
+                                              const ValueType  type,
+                                              QString         &error)
+    {
+      switch (type)
+        {
+          // store the type "Integer" as an int
+          case integer_value:
+            {
+              bool ok = true;
+              const int value = text.toInt(&ok);
+
+              if (ok)
+                return value;
+
+              error = QObject::tr("Cannot convert integer type to integer!");
+              break;
+            }
+
+          // store the type "Double" as an double
+          case double_value:
+            {
+              bool ok = true;
+              const double value = text.toDouble(&ok);
+
+              if (ok)
+                return value;
+
+              error = QObject::tr("Cannot convert double type to double!");
+              break;
+            }
+
+          // store the type "Bool" as an boolean
+          case boolean_value:
+            {
+              QRegExp  test(text);
+
+              if (test.exactMatch("true"))
+                return true;
+              else if (test.exactMatch("false"))
+                return false;
+
+              error = QObject::tr("Cannot convert boolean type to boolean!");
+              return true;
+            }
+
+          // store the type "Anything" or "Filename" as a QString
+          default:
+            break;
+        }
+
+      return text;
+    }
+
+
+
     QTreeWidgetItem *XMLParameterReader::create_child_item(QTreeWidgetItem *item)
     {
       // create a new child-item
@@ -308,8 +428,7 @@ namespace dealii
         child_item = new QTreeWidgetItem(tree_widget);
 
       // set xml.tag_name as data
-      child_item->setData(0, Qt::DisplayRole, xml.name().toString());
-      child_item->setText(0, xml.name().toString());
+      child_item->setText(0, StringPool::shared(xml.name().toString()));
 
       return child_item;
     }
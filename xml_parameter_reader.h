@@ -21,6 +21,7 @@
 #include <QXmlStreamReader>
 #include <QTreeWidget>
 #include <QTreeWidgetItem>
+#include <QVector>
 
 
 namespace dealii
@@ -65,6 +66,54 @@ namespace dealii
        */
       QString error_string () const;
 
+      /**
+       * The data types values are stored as in the tree.
+       */
+      enum ValueType {string_value, integer_value, double_value, boolean_value};
+
+      /**
+       * Return the data type values of parameters with @p pattern_description are stored as.
+       * Only values of an outermost &quot;Integer&quot;, &quot;Double&quot; or &quot;Bool&quot;
+       * pattern are typed, values of composite patterns such as a &quot;Map&quot; of
+       * &quot;Integer&quot;s are text.
+       */
+      static ValueType value_type (const QString &pattern_description);
+
+      /**
+       * Return the value @p text of a parameter converted to @p type. If the conversion
+       * fails, a message is stored in @p error and the value is returned as text.
+       */
+      static QVariant typed_value (const QString   &text,
+                                   const ValueType  type,
+                                   QString         &error);
+
+      /**
+       * Reimplemented from the @ref ParameterHandler class.
+       * Unmangle a string @p s into its original form.
+       */
+      static QString  demangle (const QString &s);
+
+      /**
+       * A parameter as read by @ref read_parameters.
+       */
+      struct Parameter
+      {
+        QString  path;
+        QString  value;
+        QString  pattern_description;
+      };
+
+      /**
+       * Read the path, value and pattern description of every parameter in the XML
+       * file @p device into @p parameters, without building a tree. This function can
+       * therefore be used outside of the main thread, and for files that are too
+       * many or too large to be shown. Returns false and sets @p error if the file
+       * can not be read.
+       */
+      static bool read_parameters (QIODevice            *device,
+                                   QVector<Parameter>   &parameters,
+                                   QString              &error);
+
     private:
       /**
        * This function implements a loop over the XML file
@@ -99,12 +148,6 @@ namespace dealii
        */
       void read_parameter_element (QTreeWidgetItem *parent);
 
-      /**
-       * Reimplemented from the @ref ParameterHandler class.
-       * Unmangle a string @p s into its original form.
-       */
-      QString  demangle (const QString &s);
-
       /**
        * This helper function creates a new child of @p item in the tree.
        */
@@ -57,6 +57,14 @@ namespace dealii
        */
       bool write_xml_file (QIODevice *device);
 
+      /**
+       * Reimplemented from the @ref ParameterHandler class.
+       * Mangle a string @p s so that it
+       * doesn't contain any special
+       * characters or spaces.
+       */
+      static QString  mangle (const QString &s);
+
     private:
       /**
        * This function writes a given @p item of <tt>tree_widget</tt>
@@ -75,14 +83,6 @@ namespace dealii
        */
       void write_item (QTreeWidgetItem *item);
 
-      /**
-       * Reimplemented from the @ref ParameterHandler class.
-       * Mangle a string @p s so that it
-       * doesn't contain any special
-       * characters or spaces.
-       */
-      QString  mangle (const QString &s);
-
       /**
        * An QXmlStreamWriter object
        * which implements the functionalities
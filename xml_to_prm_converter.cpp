@@ -0,0 +1,199 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#include "xml_to_prm_converter.h"
+#include "parameter_pattern.h"
+#include "parameter_value.h"
+#include "prm_parameter_writer.h"
+
+#include <QObject>
+#include <QStringList>
+
+namespace dealii
+{
+  namespace ParameterGui
+  {
+    XMLToPRMConverter::XMLToPRMConverter()
+                     : output(0)
+    {
+    }
+
+
+
+    bool XMLToPRMConverter::convert(QIODevice *input,
+                                    QIODevice *output)
+    {
+      xml.setDevice(input);
+      this->output = output;
+      sections.clear();
+
+      // look for the root element <ParameterHandler>
+      while (xml.readNext() != QXmlStreamReader::Invalid)
+        if (xml.isStartElement())
+          break;
+
+      if (!xml.isStartElement() || xml.name() != "ParameterHandler")
+        {
+          if (!xml.hasError())
+            xml.raiseError(QObject::tr("The file is not an ParameterHandler XML file."));
+          return false;
+        }
+
+      while (xml.readNext() != QXmlStreamReader::Invalid)
+        {
+          if (xml.isEndElement())
+            {
+              // the closing </ParameterHandler>
+              if (sections.isEmpty())
+                break;
+
+              const Section section = sections.last();
+              sections.pop_back();
+
+              if (section.opened)
+                write(PRMParameterWriter::end_line(sections.size()));
+            }
+          else if (xml.isStartElement())
+            {
+              if (xml.name() == "value" && !sections.isEmpty())
+                read_parameter();
+              else
+                {
+                  Section section;
+                  section.name = XMLParameterReader::demangle(xml.name().toString());
+                  section.opened = false;
+                  sections.append(section);
+                }
+            }
+        }
+
+      return !xml.hasError();
+    }
+
+
+
+    QString XMLToPRMConverter::error_string() const
+    {
+      return QObject::tr("%1\nLine %2, column %3")
+             .arg(xml.errorString())
+             .arg(xml.lineNumber())
+             .arg(xml.columnNumber());
+    }
+
+
+
+    void XMLToPRMConverter::set_placeholders(const QHash<QString, QString> &placeholders)
+    {
+      this->placeholders = placeholders;
+    }
+
+
+
+    void XMLToPRMConverter::read_parameter()
+    {
+      const QString text = xml.readElementText();
+      QString default_value, pattern_description;
+
+      // read the remaining elements of the parameter, the end element
+      // of the parameter is handled by convert()
+      while (xml.readNext() != QXmlStreamReader::Invalid)
+        if (xml.isStartElement())
+          {
+            if (xml.name() == "default_value")
+              default_value = xml.readElementText();
+            else if (xml.name() == "documentation" || xml.name() == "pattern")
+              xml.skipCurrentElement();
+            else if (xml.name() == "pattern_description")
+              {
+                pattern_description = xml.readElementText();
+                break;
+              }
+            else
+              {
+                xml.raiseError(QObject::tr("Incomplete or unknown Parameter!"));
+                return;
+              }
+          }
+
+      if (xml.hasError())
+        return;
+
+      if (!placeholders.isEmpty())
+        {
+          QStringList path;
+          for (int i = 0; i < sections.size(); ++i)
+            path.append(sections[i].name);
+
+          const QHash<QString, QString>::const_iterator
+            placeholder = placeholders.constFind(path.join("/"));
+
+          if (placeholder != placeholders.constEnd())
+            {
+              open_sections();
+              write(PRMParameterWriter::set_line(sections.last().name,
+                                                 placeholder.value(),
+                                                 sections.size()-1));
+              return;
+            }
+        }
+
+      QHash<QString, XMLParameterReader::ValueType>::const_iterator
+        type = value_types.constFind(pattern_description);
+      if (type == value_types.constEnd())
+        type = value_types.insert(pattern_description,
+                                  XMLParameterReader::value_type(pattern_description));
+
+      QString error;
+      const QVariant value = XMLParameterReader::typed_value(text, type.value(), error);
+
+      if (!error.isEmpty())
+        {
+          xml.raiseError(error);
+          return;
+        }
+
+      if (ParameterValue::equal(value, default_value,
+                                ParameterPattern::get(pattern_description)))
+        return;
+
+      open_sections();
+      write(PRMParameterWriter::set_line(sections.last().name,
+                                         value.toString(),
+                                         sections.size()-1));
+    }
+
+
+
+    void XMLToPRMConverter::open_sections()
+    {
+      // the last section is the parameter itself
+      for (int i = 0; i < sections.size()-1; ++i)
+        if (!sections[i].opened)
+          {
+            write(PRMParameterWriter::subsection_line(sections[i].name, i));
+            sections[i].opened = true;
+          }
+    }
+
+
+
+    void XMLToPRMConverter::write(const QString &line)
+    {
+      output->write(line.toLatin1());
+    }
+  }
+}
@@ -0,0 +1,144 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// The deal.II library is free software; you can use it, redistribute
+// it, and/or modify it under the terms of the GNU Lesser General
+// Public License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+// The full text of the license can be found in the file LICENSE at
+// the top level of the deal.II distribution.
+//
+// ---------------------------------------------------------------------
+
+
+
+#ifndef XMLTOPRMCONVERTER_H
+#define XMLTOPRMCONVERTER_H
+
+#include <QHash>
+#include <QIODevice>
+#include <QString>
+#include <QVector>
+#include <QXmlStreamReader>
+
+#include "xml_parameter_reader.h"
+
+
+namespace dealii
+{
+  /*! @addtogroup ParameterGui
+   *@{
+   */
+  namespace ParameterGui
+  {
+    /**
+     * The XMLToPRMConverter class converts a parameter file in XML format to deal.II's
+     * PRM format without building a tree of the parameters. It reads the file with a
+     * QXmlStreamReader and writes a <tt>set</tt> line for every parameter that does not
+     * have its default value as soon as the parameter is read. The only state is the
+     * stack of the subsections the reader is in: the <tt>subsection</tt> line of a
+     * subsection is only written before its first <tt>set</tt> line, and its
+     * <tt>end</tt> line only if it was opened.
+     *
+     * The output is the same as that of the @ref PRMParameterWriter for a tree read
+     * by the @ref XMLParameterReader from the same file: values are converted to the
+     * same data types, compared to their defaults with ParameterValue::equal, and the
+     * lines are formatted by the PRMParameterWriter itself.
+     *
+     * @note This class is used in the graphical user interface for the @ref ParameterHandler class.
+     *       It is not compiled into the deal.II libraries and can not be used by applications using deal.II.
+     *
+     * @ingroup ParameterGui
+     */
+    class XMLToPRMConverter
+    {
+    public:
+      /**
+       * Constructor.
+       */
+      XMLToPRMConverter ();
+
+      /**
+       * Read the parameters in XML format from @p input and write
+       * them in PRM format to @p output. Returns false if @p input
+       * is not a valid parameter file.
+       */
+      bool convert (QIODevice *input,
+                    QIODevice *output);
+
+      /**
+       * This function returns an error message.
+       */
+      QString error_string () const;
+
+      /**
+       * Write the <tt>set</tt> lines of the parameters in @p placeholders, given by
+       * their paths as shown in the parameterGUI, with the text stored for them
+       * instead of their values, even if the values are the defaults. The text is
+       * not converted or checked, it may e.g. be a marker that is replaced later on.
+       */
+      void set_placeholders (const QHash<QString, QString> &placeholders);
+
+    private:
+      /**
+       * A subsection or parameter the reader is in.
+       */
+      struct Section
+      {
+        QString  name;
+        bool     opened;
+      };
+
+      /**
+       * Read the rest of the parameter whose <code>&lt;value&gt;</code>
+       * element was just started and write it if it does not have its
+       * default value.
+       */
+      void read_parameter ();
+
+      /**
+       * Write the <tt>subsection</tt> lines of the sections that enclose
+       * the current parameter and were not opened yet.
+       */
+      void open_sections ();
+
+      /**
+       * Write @p line to <tt>output</tt>.
+       */
+      void write (const QString &line);
+
+      /**
+       * The QXmlStreamReader object for reading the file.
+       */
+      QXmlStreamReader  xml;
+
+      /**
+       * The device the PRM file is written to.
+       */
+      QIODevice *output;
+
+      /**
+       * The subsections the reader is in, the last one may be a parameter.
+       */
+      QVector<Section> sections;
+
+      /**
+       * The data types of values by pattern description, which are
+       * the same for many parameters.
+       */
+      QHash<QString, XMLParameterReader::ValueType> value_types;
+
+      /**
+       * The texts written instead of the values of some parameters by their paths.
+       */
+      QHash<QString, QString> placeholders;
+    };
+  }
+  /**@}*/
+}
+
+
+#endif